@@ -0,0 +1,273 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueAsyncPoster.h"
+
+#include "AkGameplayCueEndOfEventQueue.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueStopQueue.h"
+#include "Misc/ScopeLock.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+namespace AkGameplayCueAsyncPoster
+{
+	/** Right below the loop aggregator's instance IDs. */
+	constexpr AkPlayingID FirstHandle = 0xE0000000u;
+	constexpr AkPlayingID EndHandle = 0xF0000000u;
+
+	/** How long (in seconds) handles of one-shot posts stay resolvable.  Longer than anything holds on to a one-shot's ID. */
+	constexpr double HandleLifetime = 30.0;
+}
+
+static FAutoConsoleCommand DumpAsyncPostsCommand(
+	TEXT("AkGameplayCue.DumpAsyncPosts"),
+	TEXT("Logs the number of pending and resolved async Ak gameplay cue posts."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FAkGameplayCueAsyncPoster::Get().Dump();
+	}));
+
+FAkGameplayCueAsyncPoster& FAkGameplayCueAsyncPoster::Get()
+{
+	static FAkGameplayCueAsyncPoster Instance;
+	return Instance;
+}
+
+bool FAkGameplayCueAsyncPoster::IsHandle(AkPlayingID PlayingID)
+{
+	return (PlayingID >= AkGameplayCueAsyncPoster::FirstHandle) && (PlayingID < AkGameplayCueAsyncPoster::EndHandle);
+}
+
+void FAkGameplayCueAsyncPoster::Initialize()
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAkGameplayCueAsyncPoster::Tick));
+}
+
+void FAkGameplayCueAsyncPoster::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	Flush();
+
+	PendingHandles.Empty();
+	PendingStops.Empty();
+	ResolvedHandles.Empty();
+}
+
+bool FAkGameplayCueAsyncPoster::IsEnabled() const
+{
+	return (SynchronousDepth == 0) && UAkGameplayCueSettings::Get()->bAsyncPosting;
+}
+
+FAkGameplayCueAsyncPoster::FScopedSynchronousPosts::FScopedSynchronousPosts(bool bInActive)
+	: bActive(bInActive)
+{
+	if (bActive)
+	{
+		++FAkGameplayCueAsyncPoster::Get().SynchronousDepth;
+	}
+}
+
+FAkGameplayCueAsyncPoster::FScopedSynchronousPosts::~FScopedSynchronousPosts()
+{
+	if (bActive)
+	{
+		--FAkGameplayCueAsyncPoster::Get().SynchronousDepth;
+	}
+}
+
+AkPlayingID FAkGameplayCueAsyncPoster::Submit(FAkGameplayCueAsyncPost&& Post, bool bPersistent)
+{
+	// Skip handles that are still in use after wrapping around.
+	AkPlayingID Handle;
+	do
+	{
+		if ((NextHandle < AkGameplayCueAsyncPoster::FirstHandle) || (NextHandle >= AkGameplayCueAsyncPoster::EndHandle))
+		{
+			NextHandle = AkGameplayCueAsyncPoster::FirstHandle;
+		}
+
+		Handle = NextHandle++;
+	}
+	while (PendingHandles.Contains(Handle) || ResolvedHandles.Contains(Handle));
+
+	PendingHandles.Add(Handle, bPersistent);
+	Commands.Enqueue({ Handle, MoveTemp(Post) });
+
+	ScheduleWorker();
+
+	return Handle;
+}
+
+bool FAkGameplayCueAsyncPoster::Resolve(AkPlayingID Handle, AkPlayingID& OutPlayingID)
+{
+	DrainResults();
+
+	if (PendingHandles.Contains(Handle))
+	{
+		return false;
+	}
+
+	const FResolvedHandle* Resolved = ResolvedHandles.Find(Handle);
+	OutPlayingID = Resolved ? Resolved->PlayingID : AK_INVALID_PLAYING_ID;
+
+	return true;
+}
+
+void FAkGameplayCueAsyncPoster::Stop(AkPlayingID Handle, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation)
+{
+	DrainResults();
+
+	if (PendingHandles.Contains(Handle))
+	{
+		PendingStops.Add(Handle, { FadeDurationMs, FadeInterpolation });
+		return;
+	}
+
+	FResolvedHandle Resolved;
+	if (ResolvedHandles.RemoveAndCopyValue(Handle, Resolved) && (Resolved.PlayingID != AK_INVALID_PLAYING_ID))
+	{
+		FAkGameplayCueStopQueue::Get().Stop(Resolved.PlayingID, FadeDurationMs, FadeInterpolation);
+	}
+}
+
+void FAkGameplayCueAsyncPoster::Flush()
+{
+	// Not gated on bWorkerScheduled, a worker clears it before its last look at the queue and may still be draining.
+	// Only the game thread launches workers, so once all of them completed nothing else touches the queue.
+	UE::Tasks::Wait(WorkerTasks);
+	WorkerTasks.Reset();
+
+	// The workers may have stopped right before the last commands were queued.
+	DrainCommands();
+	DrainResults();
+}
+
+void FAkGameplayCueAsyncPoster::Dump() const
+{
+	int32 NumPersistent = 0;
+	for (const TPair<AkPlayingID, FResolvedHandle>& Pair : ResolvedHandles)
+	{
+		NumPersistent += Pair.Value.bPersistent ? 1 : 0;
+	}
+
+	UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Async posts: %s, %d pending, %d pending stops, %d resolved (%d persistent)."),
+		UAkGameplayCueSettings::Get()->bAsyncPosting ? TEXT("enabled") : TEXT("disabled"), PendingHandles.Num(), PendingStops.Num(), ResolvedHandles.Num(), NumPersistent);
+}
+
+void FAkGameplayCueAsyncPoster::ScheduleWorker()
+{
+	if (!bWorkerScheduled.exchange(true))
+	{
+		// Keeps its allocation, finished tasks are dropped before adding the next one.
+		WorkerTasks.RemoveAll([](const UE::Tasks::FTask& Task)
+		{
+			return Task.IsCompleted();
+		});
+
+		WorkerTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [this]()
+		{
+			for (;;)
+			{
+				DrainCommands();
+
+				// Commands queued between draining and clearing the flag would be stranded, pick them up unless a new task will.
+				// A new task may already be draining, HasCommands and DrainCommands wait for it rather than consuming alongside.
+				bWorkerScheduled = false;
+				if (!HasCommands() || bWorkerScheduled.exchange(true))
+				{
+					break;
+				}
+			}
+		}));
+	}
+}
+
+bool FAkGameplayCueAsyncPoster::HasCommands()
+{
+	FScopeLock DrainLock(&DrainCriticalSection);
+	return !Commands.IsEmpty();
+}
+
+void FAkGameplayCueAsyncPoster::DrainCommands()
+{
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_AsyncPostWorker);
+
+	FScopeLock DrainLock(&DrainCriticalSection);
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	const bool bSoundEngineReady = SoundEngine && SoundEngine->IsInitialized();
+
+	FCommand Command;
+	while (Commands.Dequeue(Command))
+	{
+		const FAkGameplayCueAsyncPost& Post = Command.Post;
+		AkPlayingID PlayingID = AK_INVALID_PLAYING_ID;
+
+		if (bSoundEngineReady)
+		{
+			if (Post.Position.IsSet())
+			{
+				SoundEngine->SetPosition(Post.GameObjectID, Post.Position.GetValue());
+			}
+
+			Post.BoundParameters.ApplySwitches(Post.GameObjectID);
+			PlayingID = SoundEngine->PostEvent(Post.EventID, Post.GameObjectID, Post.CallbackFlags, Post.Callback, Post.Cookie);
+			Post.BoundParameters.ApplyRtpcValues(PlayingID);
+		}
+
+		if ((PlayingID == AK_INVALID_PLAYING_ID) && Post.FailureQueue)
+		{
+			Post.FailureQueue->Enqueue({ PlayingID, Post.GameObjectID });
+		}
+
+		Results.Enqueue({ Command.Handle, PlayingID });
+	}
+}
+
+void FAkGameplayCueAsyncPoster::DrainResults()
+{
+	const double Now = FPlatformTime::Seconds();
+
+	FResult Result;
+	while (Results.Dequeue(Result))
+	{
+		bool bPersistent = false;
+		PendingHandles.RemoveAndCopyValue(Result.Handle, bPersistent);
+
+		FPendingStop PendingStop;
+		if (PendingStops.RemoveAndCopyValue(Result.Handle, PendingStop))
+		{
+			FAkGameplayCueStopQueue::Get().Stop(Result.PlayingID, PendingStop.FadeDurationMs, PendingStop.FadeInterpolation);
+
+			continue;
+		}
+
+		ResolvedHandles.Add(Result.Handle, { Result.PlayingID, Now + AkGameplayCueAsyncPoster::HandleLifetime, bPersistent });
+	}
+}
+
+bool FAkGameplayCueAsyncPoster::Tick(float DeltaTime)
+{
+	DrainResults();
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now < NextPruneTime)
+	{
+		return true;
+	}
+
+	NextPruneTime = Now + 1.0;
+
+	for (auto It = ResolvedHandles.CreateIterator(); It; ++It)
+	{
+		if (!It.Value().bPersistent && (It.Value().ExpireTime < Now))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	return true;
+}
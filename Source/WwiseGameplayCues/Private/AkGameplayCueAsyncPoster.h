@@ -0,0 +1,158 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueTypes.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/CriticalSection.h"
+#include "Tasks/Task.h"
+
+#include <AK/SoundEngine/Common/AkCallback.h>
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+#include <atomic>
+
+class FAkGameplayCueEndOfEventQueue;
+
+/** Everything a worker needs to post an event on a game object that is already registered. */
+struct FAkGameplayCueAsyncPost
+{
+	AkUniqueID EventID = AK_INVALID_UNIQUE_ID;
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+
+	/** Set on the game object right before the post, if set. */
+	TOptional<AkSoundPosition> Position;
+
+	AkUInt32 CallbackFlags = 0;
+	AkCallbackFunc Callback = nullptr;
+	void* Cookie = nullptr;
+
+	/** Told about failed posts, so whoever waits for the end of the event on the game object doesn't wait forever. */
+	FAkGameplayCueEndOfEventQueue* FailureQueue = nullptr;
+
+	FAkGameplayCueBoundParameters BoundParameters;
+};
+
+/**
+ * FAkGameplayCueAsyncPoster
+ *
+ *	Moves the sound engine calls of posts on pooled and cached emitters off the game thread.
+ *	The game thread pushes post commands through a lock-free queue and gets a handle back right away, a worker task drains
+ *	the queue into the sound engine.  Handles come from a reserved range below the loop aggregator's instance IDs, so they
+ *	can live in spawn results next to real playing IDs, and resolve to the playing ID once the worker posted the event.
+ *	Everything but the worker is game thread only.
+ */
+class FAkGameplayCueAsyncPoster
+{
+public:
+	static FAkGameplayCueAsyncPoster& Get();
+
+	/** Returns true if the ID is a handle of an async post rather than a playing ID. */
+	static bool IsHandle(AkPlayingID PlayingID);
+
+	/** Starts pruning resolved handles.  Called on module startup. */
+	void Initialize();
+
+	/** Finishes all pending posts and drops all handles.  Called on module shutdown. */
+	void Shutdown();
+
+	/** Returns true if posts should go through Submit. */
+	bool IsEnabled() const;
+
+	/** Posts made while alive are synchronous, for options that need the playing ID at post time. */
+	struct FScopedSynchronousPosts
+	{
+		FScopedSynchronousPosts(bool bInActive);
+		~FScopedSynchronousPosts();
+
+		UE_NONCOPYABLE(FScopedSynchronousPosts);
+
+	private:
+		bool bActive;
+	};
+
+	/**
+	 * Queues a post for the worker.
+	 * Handles of persistent posts (infinite events) stay resolvable until stopped, all others for a limited time only.
+	 * @return The handle of the post.
+	 */
+	AkPlayingID Submit(FAkGameplayCueAsyncPost&& Post, bool bPersistent);
+
+	/**
+	 * Looks up the playing ID of a handle.
+	 * @return False while the post is still pending.  Otherwise OutPlayingID is set, to AK_INVALID_PLAYING_ID if the post failed or the handle expired.
+	 */
+	bool Resolve(AkPlayingID Handle, AkPlayingID& OutPlayingID);
+
+	/** Stops the post of a handle, right away if it was posted already or as soon as it is. */
+	void Stop(AkPlayingID Handle, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation);
+
+	/** Waits for the worker to post everything queued so far.  Called before anything the queued posts point to goes away. */
+	void Flush();
+
+	/** Logs the number of pending and resolved handles. */
+	void Dump() const;
+
+private:
+	struct FCommand
+	{
+		AkPlayingID Handle;
+		FAkGameplayCueAsyncPost Post;
+	};
+
+	struct FResult
+	{
+		AkPlayingID Handle;
+		AkPlayingID PlayingID;
+	};
+
+	struct FResolvedHandle
+	{
+		AkPlayingID PlayingID;
+		double ExpireTime;
+		bool bPersistent;
+	};
+
+	struct FPendingStop
+	{
+		AkTimeMs FadeDurationMs;
+		AkCurveInterpolation FadeInterpolation;
+	};
+
+	void ScheduleWorker();
+	void DrainCommands();
+	bool HasCommands();
+	void DrainResults();
+	bool Tick(float DeltaTime);
+
+	/** Filled by the game thread, drained by the worker. */
+	TQueue<FCommand, EQueueMode::Spsc> Commands;
+
+	/** Filled by the worker, drained by the game thread. */
+	TQueue<FResult, EQueueMode::Spsc> Results;
+
+	/**
+	 * Held by whoever consumes Commands (and so produces Results).
+	 * A worker that finished may still take a last look at the queue while the next one already drains it.
+	 */
+	FCriticalSection DrainCriticalSection;
+
+	/** Set while a worker task is scheduled or draining. */
+	std::atomic<bool> bWorkerScheduled = false;
+
+	/** Worker tasks that may still be running.  Game thread only. */
+	TArray<UE::Tasks::FTask> WorkerTasks;
+
+	/** Submitted handles that have no result yet, and whether they are persistent. */
+	TMap<AkPlayingID, bool> PendingHandles;
+	TMap<AkPlayingID, FPendingStop> PendingStops;
+	TMap<AkPlayingID, FResolvedHandle> ResolvedHandles;
+
+	AkPlayingID NextHandle = 0;
+	int32 SynchronousDepth = 0;
+	double NextPruneTime = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+};
@@ -0,0 +1,191 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueAttachedEmitterCache.h"
+
+#include "AkComponent.h"
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueSettings.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/WorldSettings.h"
+
+void FAkGameplayCueAttachedEmitterCache::Initialize(UWorld& InWorld)
+{
+	const UAkGameplayCueSettings* Settings = UAkGameplayCueSettings::Get();
+	if (!Settings->bCacheAttachedEmitters)
+	{
+		return;
+	}
+
+	World = &InWorld;
+
+	FreeEmitters.Reserve(Settings->AttachedEmitterPoolSize);
+	for (int32 Index = 0; Index < Settings->AttachedEmitterPoolSize; ++Index)
+	{
+		if (UAkComponent* Emitter = CreateEmitter())
+		{
+			FreeEmitters.Add(Emitter);
+		}
+	}
+
+	if (Settings->bPrewarmAttachedEmittersForPawns)
+	{
+		ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateRaw(this, &FAkGameplayCueAttachedEmitterCache::OnActorSpawned));
+	}
+}
+
+void FAkGameplayCueAttachedEmitterCache::Deinitialize()
+{
+	if (UWorld* CurrentWorld = World.Get())
+	{
+		CurrentWorld->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+
+	for (const TPair<FKey, FCachedEmitter>& Pair : CachedEmitters)
+	{
+		UAkComponent* Emitter = Pair.Value.Emitter.Get();
+		if (Emitter && Pair.Value.bPooled)
+		{
+			Emitter->DestroyComponent();
+		}
+	}
+
+	for (const TWeakObjectPtr<UAkComponent>& FreeEmitter : FreeEmitters)
+	{
+		if (UAkComponent* Emitter = FreeEmitter.Get())
+		{
+			Emitter->DestroyComponent();
+		}
+	}
+
+	CachedEmitters.Empty();
+	FreeEmitters.Empty();
+	ActorSpawnedHandle.Reset();
+	World.Reset();
+}
+
+UAkComponent* FAkGameplayCueAttachedEmitterCache::FindOrAdd(USceneComponent* AttachComponent, FName SocketName)
+{
+	if (!World.IsValid() || !IsValid(AttachComponent))
+	{
+		return nullptr;
+	}
+
+	const FKey Key{ AttachComponent, SocketName };
+	if (const FCachedEmitter* Cached = CachedEmitters.Find(Key))
+	{
+		UAkComponent* Emitter = Cached->Emitter.Get();
+		if (Emitter && (Emitter->GetAttachParent() == AttachComponent))
+		{
+			return Emitter;
+		}
+
+		CachedEmitters.Remove(Key);
+	}
+
+	// An Ak component the target carries at the socket already is what game code sets its RTPCs and switches on, prefer that one.
+	for (USceneComponent* Child : AttachComponent->GetAttachChildren())
+	{
+		UAkComponent* OwnEmitter = Cast<UAkComponent>(Child);
+		if (OwnEmitter && (OwnEmitter->GetAttachSocketName() == SocketName) && OwnEmitter->IsRegistered())
+		{
+			CachedEmitters.Add(Key, { AttachComponent, OwnEmitter, false });
+			return OwnEmitter;
+		}
+	}
+
+	UAkComponent* Emitter = nullptr;
+	while (!Emitter && !FreeEmitters.IsEmpty())
+	{
+		Emitter = FreeEmitters.Pop(EAllowShrinking::No).Get();
+	}
+
+	if (!Emitter)
+	{
+		Emitter = CreateEmitter();
+		if (!Emitter)
+		{
+			return nullptr;
+		}
+	}
+
+	Emitter->AttachToComponent(AttachComponent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
+	CachedEmitters.Add(Key, { AttachComponent, Emitter, true });
+
+	return Emitter;
+}
+
+void FAkGameplayCueAttachedEmitterCache::ReleaseDestroyedTargets()
+{
+	bool bFlushedAsyncPosts = false;
+
+	for (auto It = CachedEmitters.CreateIterator(); It; ++It)
+	{
+		const FCachedEmitter& Cached = It.Value();
+		if (Cached.AttachComponent.IsValid())
+		{
+			continue;
+		}
+
+		// Same as posting on the actor with bStopWhenAttachedObjectDestroyed.
+		UAkComponent* Emitter = Cached.Emitter.Get();
+		if (Emitter && Cached.bPooled)
+		{
+			// Async posts bypass the component's event tracking, they have to reach the sound engine before the stop or they would play on the emitter's next target.
+			if (!bFlushedAsyncPosts)
+			{
+				FAkGameplayCueAsyncPoster::Get().Flush();
+				bFlushedAsyncPosts = true;
+			}
+
+			Emitter->Stop();
+			Emitter->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+			FreeEmitters.Add(Emitter);
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+UAkComponent* FAkGameplayCueAttachedEmitterCache::SpawnDedicated(USceneComponent* AttachComponent, FName SocketName)
+{
+	UWorld* AttachWorld = IsValid(AttachComponent) ? AttachComponent->GetWorld() : nullptr;
+	AWorldSettings* WorldSettings = AttachWorld ? AttachWorld->GetWorldSettings() : nullptr;
+	if (!WorldSettings)
+	{
+		return nullptr;
+	}
+
+	UAkComponent* Emitter = NewObject<UAkComponent>(WorldSettings, NAME_None, RF_Transient);
+	Emitter->bAutoDestroy = true;
+	Emitter->RegisterComponentWithWorld(AttachWorld);
+	Emitter->AttachToComponent(AttachComponent, FAttachmentTransformRules::SnapToTargetNotIncludingScale, SocketName);
+
+	return Emitter;
+}
+
+UAkComponent* FAkGameplayCueAttachedEmitterCache::CreateEmitter()
+{
+	UWorld* CurrentWorld = World.Get();
+	AWorldSettings* WorldSettings = CurrentWorld ? CurrentWorld->GetWorldSettings() : nullptr;
+	if (!WorldSettings)
+	{
+		return nullptr;
+	}
+
+	// Owned by the world settings like the integration's spawned components, so they outlive the actors they are attached to.
+	UAkComponent* Emitter = NewObject<UAkComponent>(WorldSettings, NAME_None, RF_Transient);
+	Emitter->bAutoDestroy = false;
+	Emitter->RegisterComponentWithWorld(CurrentWorld);
+
+	return Emitter;
+}
+
+void FAkGameplayCueAttachedEmitterCache::OnActorSpawned(AActor* Actor)
+{
+	if (const APawn* Pawn = Cast<APawn>(Actor))
+	{
+		FindOrAdd(Pawn->GetRootComponent(), NAME_None);
+	}
+}
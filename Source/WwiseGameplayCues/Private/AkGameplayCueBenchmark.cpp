@@ -0,0 +1,395 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#include "CoreMinimal.h"
+
+#if !UE_BUILD_SHIPPING
+
+#include "AbilitySystemGlobals.h"
+#include "AkGameplayCueCountingMalloc.h"
+#include "AkGameplayCueNotify_Burst.h"
+#include "AkGameplayCueNotify_Looping.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTypes.h"
+#include "Components/SceneComponent.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameplayCueManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+/**
+ * Headless benchmark of the plugin's hot paths.
+ *
+ *	Fires bursts and drives looping cue cycles over a number of frames and writes the results as JSON.
+ *	Meant to be run with -nullrhi (and -nosound for an offline sound engine), e.g.:
+ *		UnrealEditor-Cmd MyProject MyMap -game -nullrhi -nosound -ExecCmds="AkGameplayCue.Benchmark Frames=300 Quit"
+ *
+ *	Arguments (all optional):
+ *		BurstClass=<path>		UAkGameplayCueNotify_Burst class to execute.  Defaults to the native class.
+ *		LoopingClass=<path>		AAkGameplayCueNotify_Looping class to cycle.  Defaults to the native class.
+ *		Bursts=<N>				Burst executions per frame.
+ *		Targets=<M>				Number of target actors the cues are spread across.
+ *		Frames=<F>				Number of frames of the burst scenario.
+ *		Loops=<K>				Total number of OnActive/WhileActive/OnRemove/Recycle cycles.
+ *		LoopsPerFrame=<L>		Looping cycles per frame.
+ *		Output=<file>			Where to write the JSON report.  Defaults to Saved/AkGameplayCues/.
+ *		Quit					Request exit once the report is written.
+ */
+namespace AkGameplayCueBenchmark
+{
+	struct FScenarioResult
+	{
+		FString Name;
+		uint64 NumCues = 0;
+		uint64 Cycles = 0;
+		uint64 NumAllocations = 0;
+		uint64 PeakUsedPhysical = 0;
+		int32 NumCueActors = 0;
+		int32 NumRecycledCueActors = 0;
+
+		TSharedRef<FJsonObject> ToJson() const
+		{
+			const double NumCuesDouble = static_cast<double>(FMath::Max<uint64>(NumCues, 1));
+
+			TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+			Json->SetStringField(TEXT("Name"), Name);
+			Json->SetNumberField(TEXT("NumCues"), static_cast<double>(NumCues));
+			Json->SetNumberField(TEXT("NsPerCue"), FPlatformTime::ToMilliseconds64(Cycles) * 1000000.0 / NumCuesDouble);
+
+			if (FAkGameplayCueCountingMalloc::Get().CountsAllocations())
+			{
+				Json->SetNumberField(TEXT("AllocationsPerCue"), static_cast<double>(NumAllocations) / NumCuesDouble);
+			}
+			else
+			{
+				Json->SetStringField(TEXT("AllocationsPerCue"), TEXT("unavailable"));
+			}
+
+			Json->SetNumberField(TEXT("PeakUsedPhysicalBytes"), static_cast<double>(PeakUsedPhysical));
+			Json->SetNumberField(TEXT("CueActors"), NumCueActors);
+			Json->SetNumberField(TEXT("RecycledCueActors"), NumRecycledCueActors);
+			return Json;
+		}
+	};
+
+	/** Measures a section of a scenario: time, game thread allocations and peak memory. */
+	struct FScopedMeasurement
+	{
+		explicit FScopedMeasurement(FScenarioResult& InResult)
+			: Result(InResult)
+		{
+			// Installing may run the sanity check allocation, which isn't part of the measurement.
+			FAkGameplayCueCountingMalloc::Get().Install();
+			StartAllocations = FAkGameplayCueCountingMalloc::Get().GetNumAllocations();
+			StartCycles = FPlatformTime::Cycles64();
+		}
+
+		~FScopedMeasurement()
+		{
+			Result.Cycles += FPlatformTime::Cycles64() - StartCycles;
+			FAkGameplayCueCountingMalloc::Get().Uninstall();
+
+			Result.NumAllocations += FAkGameplayCueCountingMalloc::Get().GetNumAllocations() - StartAllocations;
+			Result.PeakUsedPhysical = FMath::Max<uint64>(Result.PeakUsedPhysical, FPlatformMemory::GetStats().PeakUsedPhysical);
+		}
+
+	private:
+		FScenarioResult& Result;
+		uint64 StartAllocations = 0;
+		uint64 StartCycles = 0;
+	};
+
+	class FBenchmarkRun : public TSharedFromThis<FBenchmarkRun>
+	{
+	public:
+		FBenchmarkRun(UWorld* InWorld, const TArray<FString>& Args)
+			: World(InWorld)
+		{
+			const FString Joined = FString::Join(Args, TEXT(" "));
+
+			FString ClassPath;
+			if (FParse::Value(*Joined, TEXT("BurstClass="), ClassPath))
+			{
+				BurstClass = LoadClass<UAkGameplayCueNotify_Burst>(nullptr, *ClassPath);
+			}
+
+			if (FParse::Value(*Joined, TEXT("LoopingClass="), ClassPath))
+			{
+				LoopingClass = LoadClass<AAkGameplayCueNotify_Looping>(nullptr, *ClassPath);
+			}
+
+			FParse::Value(*Joined, TEXT("Bursts="), NumBurstsPerFrame);
+			FParse::Value(*Joined, TEXT("Targets="), NumTargets);
+			FParse::Value(*Joined, TEXT("Frames="), NumBurstFrames);
+			FParse::Value(*Joined, TEXT("Loops="), NumLoopingCycles);
+			FParse::Value(*Joined, TEXT("LoopsPerFrame="), NumLoopingCyclesPerFrame);
+			FParse::Value(*Joined, TEXT("Output="), OutputPath);
+			bQuitWhenDone = Args.Contains(TEXT("Quit"));
+
+			NumTargets = FMath::Max(NumTargets, 1);
+			NumLoopingCyclesPerFrame = FMath::Max(NumLoopingCyclesPerFrame, 1);
+
+			if (!BurstClass)
+			{
+				BurstClass = UAkGameplayCueNotify_Burst::StaticClass();
+			}
+
+			if (!LoopingClass)
+			{
+				LoopingClass = AAkGameplayCueNotify_Looping::StaticClass();
+			}
+
+			if (OutputPath.IsEmpty())
+			{
+				OutputPath = FPaths::ProjectSavedDir() / TEXT("AkGameplayCues") / FString::Printf(TEXT("Benchmark-%s.json"), *FDateTime::Now().ToString());
+			}
+
+			BurstResult.Name = TEXT("Burst");
+			LoopingResult.Name = TEXT("Looping");
+		}
+
+		void Start()
+		{
+			SpawnTargets();
+
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("AkGameplayCue benchmark: %d bursts per frame over %d frames, %d looping cycles, %d targets."),
+				NumBurstsPerFrame, NumBurstFrames, NumLoopingCycles, NumTargets);
+
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FBenchmarkRun::Tick));
+		}
+
+		static TSharedPtr<FBenchmarkRun> ActiveRun;
+
+	private:
+		bool Tick(float DeltaTime)
+		{
+			if (!World.IsValid())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCue benchmark: World went away, aborting."));
+				ActiveRun.Reset();
+				return false;
+			}
+
+			if (BurstFrame < NumBurstFrames)
+			{
+				RunBurstFrame();
+				++BurstFrame;
+				return true;
+			}
+
+			if (LoopingCycle < NumLoopingCycles)
+			{
+				RunLoopingFrame();
+				return true;
+			}
+
+			Finish();
+			return false;
+		}
+
+		void RunBurstFrame()
+		{
+			UAkGameplayCueNotify_Burst* Notify = BurstClass->GetDefaultObject<UAkGameplayCueNotify_Burst>();
+
+			FScopedMeasurement Measurement(BurstResult);
+			for (int32 BurstIndex = 0; BurstIndex < NumBurstsPerFrame; ++BurstIndex)
+			{
+				AActor* Target = Targets[BurstIndex % Targets.Num()];
+
+				FGameplayCueParameters Parameters;
+				Parameters.Location = Target->GetActorLocation();
+
+				Notify->HandleGameplayCue(Target, EGameplayCueEvent::Executed, Parameters);
+			}
+
+			BurstResult.NumCues += NumBurstsPerFrame;
+		}
+
+		void RunLoopingFrame()
+		{
+			UGameplayCueManager* CueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
+			if (!CueManager)
+			{
+				LoopingCycle = NumLoopingCycles;
+				return;
+			}
+
+			const int32 NumCycles = FMath::Min(NumLoopingCyclesPerFrame, NumLoopingCycles - LoopingCycle);
+
+			FScopedMeasurement Measurement(LoopingResult);
+			for (int32 CycleIndex = 0; CycleIndex < NumCycles; ++CycleIndex)
+			{
+				AActor* Target = Targets[(LoopingCycle + CycleIndex) % Targets.Num()];
+
+				FGameplayCueParameters Parameters;
+				Parameters.Location = Target->GetActorLocation();
+
+				// Removal recycles the actor back into the cue manager's pool, the next cycle picks it up again.
+				if (AGameplayCueNotify_Actor* Instance = CueManager->GetInstancedCueActor(Target, LoopingClass, Parameters))
+				{
+					Instance->HandleGameplayCue(Target, EGameplayCueEvent::OnActive, Parameters);
+					Instance->HandleGameplayCue(Target, EGameplayCueEvent::WhileActive, Parameters);
+					Instance->HandleGameplayCue(Target, EGameplayCueEvent::Removed, Parameters);
+				}
+			}
+
+			LoopingCycle += NumCycles;
+			LoopingResult.NumCues += NumCycles;
+		}
+
+		void Finish()
+		{
+			CountCueActors(BurstResult);
+			CountCueActors(LoopingResult);
+			DestroyTargets();
+
+			TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+
+			if (TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("WwiseGameplayCues")))
+			{
+				Report->SetStringField(TEXT("PluginVersion"), Plugin->GetDescriptor().VersionName);
+			}
+
+			Report->SetStringField(TEXT("BurstClass"), BurstClass->GetPathName());
+			Report->SetStringField(TEXT("LoopingClass"), LoopingClass->GetPathName());
+			Report->SetNumberField(TEXT("BurstsPerFrame"), NumBurstsPerFrame);
+			Report->SetNumberField(TEXT("Targets"), NumTargets);
+
+			TArray<TSharedPtr<FJsonValue>> Scenarios;
+			Scenarios.Add(MakeShared<FJsonValueObject>(BurstResult.ToJson()));
+			Scenarios.Add(MakeShared<FJsonValueObject>(LoopingResult.ToJson()));
+			Report->SetArrayField(TEXT("Scenarios"), Scenarios);
+
+			if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World.Get()))
+			{
+				const FAkGameplayCueEmitterPoolStats& PoolStats = CueSubsystem->GetEmitterPool().GetStats();
+
+				TSharedRef<FJsonObject> PoolJson = MakeShared<FJsonObject>();
+				PoolJson->SetNumberField(TEXT("Emitters"), PoolStats.NumEmitters);
+				PoolJson->SetNumberField(TEXT("PeakInUse"), PoolStats.PeakInUse);
+				PoolJson->SetNumberField(TEXT("HitRate"), PoolStats.GetHitRate());
+				PoolJson->SetNumberField(TEXT("Overflows"), static_cast<double>(PoolStats.NumOverflows));
+				Report->SetObjectField(TEXT("EmitterPool"), PoolJson);
+			}
+
+			FString ReportString;
+			const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+			FJsonSerializer::Serialize(Report, Writer);
+
+			if (FFileHelper::SaveStringToFile(ReportString, *OutputPath))
+			{
+				UE_LOG(LogAkGameplayCueNotify, Display, TEXT("AkGameplayCue benchmark: Report written to %s"), *OutputPath);
+			}
+			else
+			{
+				UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCue benchmark: Failed to write report to %s"), *OutputPath);
+			}
+
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("%s"), *ReportString);
+
+			if (bQuitWhenDone)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+
+			ActiveRun.Reset();
+		}
+
+		void SpawnTargets()
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.ObjectFlags |= RF_Transient;
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			// Spread the targets on a grid, so location based features see distinct positions.
+			const int32 GridSize = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(NumTargets)));
+			for (int32 TargetIndex = 0; TargetIndex < NumTargets; ++TargetIndex)
+			{
+				AActor* Target = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+
+				USceneComponent* Root = NewObject<USceneComponent>(Target, TEXT("Root"));
+				Target->SetRootComponent(Root);
+				Root->RegisterComponent();
+				Target->SetActorLocation(FVector((TargetIndex % GridSize) * 500.0, (TargetIndex / GridSize) * 500.0, 0.0));
+
+				Targets.Add(Target);
+			}
+		}
+
+		void DestroyTargets()
+		{
+			for (AActor* Target : Targets)
+			{
+				if (IsValid(Target))
+				{
+					Target->Destroy();
+				}
+			}
+
+			Targets.Reset();
+		}
+
+		void CountCueActors(FScenarioResult& Result) const
+		{
+			for (TActorIterator<AGameplayCueNotify_Actor> It(World.Get()); It; ++It)
+			{
+				++Result.NumCueActors;
+				Result.NumRecycledCueActors += It->bInRecycleQueue ? 1 : 0;
+			}
+		}
+
+		TWeakObjectPtr<UWorld> World;
+		TArray<AActor*> Targets;
+
+		UClass* BurstClass = nullptr;
+		UClass* LoopingClass = nullptr;
+
+		int32 NumBurstsPerFrame = 64;
+		int32 NumTargets = 16;
+		int32 NumBurstFrames = 120;
+		int32 NumLoopingCycles = 2000;
+		int32 NumLoopingCyclesPerFrame = 100;
+		FString OutputPath;
+		bool bQuitWhenDone = false;
+
+		int32 BurstFrame = 0;
+		int32 LoopingCycle = 0;
+
+		FScenarioResult BurstResult;
+		FScenarioResult LoopingResult;
+
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+
+	TSharedPtr<FBenchmarkRun> FBenchmarkRun::ActiveRun;
+
+	static FAutoConsoleCommandWithWorldAndArgs BenchmarkCommand(
+		TEXT("AkGameplayCue.Benchmark"),
+		TEXT("Runs the Ak gameplay cue benchmark and writes a JSON report. See AkGameplayCueBenchmark.cpp for arguments."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || !World->IsGameWorld())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCue benchmark: Needs a game world."));
+				return;
+			}
+
+			if (FBenchmarkRun::ActiveRun.IsValid())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCue benchmark: Already running."));
+				return;
+			}
+
+			FBenchmarkRun::ActiveRun = MakeShared<FBenchmarkRun>(World, Args);
+			FBenchmarkRun::ActiveRun->Start();
+		}));
+}
+
+#endif
@@ -0,0 +1,14 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueBlueprintLibrary.h"
+
+#include "AkAudioEvent.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueBlueprintLibrary)
+
+UAkAudioEvent* UAkGameplayCueBlueprintLibrary::GetAkEvent(const FAkGameplayCueNotify_AkEventInfo& AkEventInfo)
+{
+	return AkEventInfo.AkEvent.Get();
+}
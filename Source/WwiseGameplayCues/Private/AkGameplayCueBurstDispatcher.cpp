@@ -0,0 +1,154 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueBurstDispatcher.h"
+
+#include "AkGameplayCueNotify_Burst.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "GameFramework/Actor.h"
+
+namespace AkGameplayCueBurstDispatcher
+{
+	int32 GetQueueIndex(EAkGameplayCueDispatchPriority Priority)
+	{
+		return (Priority == EAkGameplayCueDispatchPriority::Low) ? 1 : 0;
+	}
+}
+
+FAkGameplayCueBurstDispatcher::FScopedExecution::FScopedExecution(FAkGameplayCueBurstDispatcher* InDispatcher)
+	: Dispatcher(InDispatcher)
+	, StartCycles(InDispatcher ? FPlatformTime::Cycles64() : 0)
+{
+}
+
+FAkGameplayCueBurstDispatcher::FScopedExecution::~FScopedExecution()
+{
+	if (Dispatcher)
+	{
+		Dispatcher->UpdateFrame();
+		Dispatcher->SpentCycles += FPlatformTime::Cycles64() - StartCycles;
+	}
+}
+
+bool FAkGameplayCueBurstDispatcher::ShouldDefer(EAkGameplayCueDispatchPriority Priority)
+{
+	check(IsInGameThread());
+
+	if (Priority == EAkGameplayCueDispatchPriority::High)
+	{
+		++Stats.NumImmediate;
+		return false;
+	}
+
+	UpdateFrame();
+
+	// Bursts queued before this one go first, even if there is budget left.
+	const bool bDefer = IsBudgetSpent() || !Queues[AkGameplayCueBurstDispatcher::GetQueueIndex(Priority)].IsEmpty();
+	if (!bDefer)
+	{
+		++Stats.NumImmediate;
+	}
+
+	return bDefer;
+}
+
+void FAkGameplayCueBurstDispatcher::Defer(
+	const UAkGameplayCueNotify_Burst* Notify,
+	AActor* Target,
+	const FGameplayCueParameters& Parameters,
+	EAkGameplayCueDispatchPriority Priority,
+	float MaxDelay,
+	double Now)
+{
+	check(IsInGameThread());
+
+	FDeferredBurst& DeferredBurst = Queues[AkGameplayCueBurstDispatcher::GetQueueIndex(Priority)].AddDefaulted_GetRef();
+	DeferredBurst.Notify = Notify;
+	DeferredBurst.Target = Target;
+	DeferredBurst.Parameters = Parameters;
+	DeferredBurst.ExpireTime = Now + FMath::Max(MaxDelay, 0.f);
+	DeferredBurst.bHasTarget = (Target != nullptr);
+
+	++Stats.NumDeferred;
+	Stats.PeakQueued = FMath::Max(Stats.PeakQueued, GetNumQueued());
+	AkGameplayCueStats::RecordDeferredBurst();
+}
+
+void FAkGameplayCueBurstDispatcher::Tick(double Now)
+{
+	UpdateFrame();
+
+	for (TArray<FDeferredBurst>& Queue : Queues)
+	{
+		int32 NumProcessed = 0;
+		for (; NumProcessed < Queue.Num(); ++NumProcessed)
+		{
+			FDeferredBurst& DeferredBurst = Queue[NumProcessed];
+
+			const UAkGameplayCueNotify_Burst* Notify = DeferredBurst.Notify.Get();
+			AActor* Target = DeferredBurst.Target.Get();
+			if (!Notify || (DeferredBurst.bHasTarget && !IsValid(Target)) || (Now > DeferredBurst.ExpireTime))
+			{
+				++Stats.NumDropped;
+				AkGameplayCueStats::RecordDroppedBurst();
+				continue;
+			}
+
+			if (IsBudgetSpent())
+			{
+				break;
+			}
+
+			{
+				FScopedExecution ScopedExecution(this);
+				Notify->ExecuteBurst(Target, DeferredBurst.Parameters);
+			}
+
+			++Stats.NumDeferredRun;
+		}
+
+		// Executing a burst may queue others at the end, which are not in the processed range.
+		Queue.RemoveAt(0, NumProcessed, EAllowShrinking::No);
+
+		if (IsBudgetSpent())
+		{
+			break;
+		}
+	}
+}
+
+void FAkGameplayCueBurstDispatcher::Reset()
+{
+	for (TArray<FDeferredBurst>& Queue : Queues)
+	{
+		Queue.Empty();
+	}
+}
+
+void FAkGameplayCueBurstDispatcher::Dump() const
+{
+	UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Burst dispatcher: %.2f ms budget, %d queued (peak %d), %llu immediate, %llu deferred, %llu deferred run, %llu dropped."),
+		UAkGameplayCueSettings::Get()->BurstDispatchBudgetMs, GetNumQueued(), Stats.PeakQueued, Stats.NumImmediate, Stats.NumDeferred, Stats.NumDeferredRun, Stats.NumDropped);
+}
+
+int32 FAkGameplayCueBurstDispatcher::GetNumQueued() const
+{
+	return Queues[0].Num() + Queues[1].Num();
+}
+
+void FAkGameplayCueBurstDispatcher::UpdateFrame()
+{
+	if (BudgetFrame != GFrameCounter)
+	{
+		BudgetFrame = GFrameCounter;
+		SpentCycles = 0;
+	}
+}
+
+bool FAkGameplayCueBurstDispatcher::IsBudgetSpent() const
+{
+	// A budget of 0 disables deferring.
+	const float BudgetMs = UAkGameplayCueSettings::Get()->BurstDispatchBudgetMs;
+	return (BudgetMs > 0.f) && (FPlatformTime::ToMilliseconds64(SpentCycles) >= BudgetMs);
+}
@@ -0,0 +1,745 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueCapture.h"
+
+#if AK_GAMEPLAY_CUE_CAPTURE_ENABLED
+
+#include "AbilitySystemGlobals.h"
+#include "AkGameplayCueTypes.h"
+#include "Async/MappedFileHandle.h"
+#include "Components/SceneComponent.h"
+#include "Containers/Ticker.h"
+#include "Engine/World.h"
+#include "GameplayCueManager.h"
+#include "GameplayCueNotify_Actor.h"
+#include "GameplayCueNotify_Static.h"
+#include "GameplayEffectTypes.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/StrongObjectPtr.h"
+
+/**
+ * Capture and replay of Ak gameplay cue traffic.
+ *
+ *	AkGameplayCue.Capture Start [File=<file>]	Records every execution, activation and removal that reaches an Ak notify.
+ *	AkGameplayCue.Capture Stop					Finishes the capture file.  Defaults to Saved/AkGameplayCues/Captures/.
+ *	AkGameplayCue.Replay File=<file> [Speed=<x>] [Max] [Quit]
+ *		Feeds a capture back through the notifies of the current world, at the recorded pace scaled by Speed, or with Max one recorded
+ *		frame per frame.  Targets are stand-in actors moved to the recorded transforms.  Meant for headless runs, e.g.:
+ *		UnrealEditor-Cmd MyProject MyMap -game -nullrhi -nosound -ExecCmds="AkGameplayCue.Replay File=Match.akgc Max Quit"
+ *
+ *	The file is a header followed by append-only records: a type byte and a payload.  Name and actor records define the indices
+ *	cue event records refer to (starting at 1, 0 is none) before their first use, so a capture that was cut short is still readable.
+ *	Payloads are written as is, the file can be read straight from a mapping.
+ */
+namespace AkGameplayCueCapture
+{
+	constexpr uint32 FileMagic = 0x43474B41; // "AKGC"
+	constexpr uint32 FileVersion = 1;
+
+	/** Flushed to disk once it grows past this, and when the capture stops. */
+	constexpr int32 WriteBufferSize = 256 * 1024;
+
+	enum class ERecordType : uint8
+	{
+		/** uint32 length, followed by as many UTF-8 bytes.  Class, tag and physical material paths. */
+		Name,
+
+		/** uint32 name index of the actor class. */
+		Actor,
+
+		/** FCueEventRecord. */
+		CueEvent,
+	};
+
+	struct FFileHeader
+	{
+		uint32 Magic;
+		uint32 Version;
+	};
+
+	struct FCueEventRecord
+	{
+		/** Seconds since the capture started. */
+		double Time;
+
+		/** Frames since the capture started. */
+		uint32 Frame;
+
+		uint32 NotifyClass;
+		uint32 CueTag;
+		uint32 Target;
+		uint32 Instigator;
+		uint32 EffectCauser;
+		uint32 PhysicalMaterial;
+		int32 GameplayEffectLevel;
+		int32 AbilityLevel;
+		float RawMagnitude;
+		float NormalizedMagnitude;
+		float Location[3];
+		float Normal[3];
+		float TargetLocation[3];
+		float TargetRotation[4];
+		uint8 EventType;
+		uint8 Padding[3];
+	};
+
+	bool bCapturing = false;
+
+	class FRecorder
+	{
+	public:
+		~FRecorder()
+		{
+			Stop();
+		}
+
+		bool Start(const FString& InPath)
+		{
+			check(IsInGameThread());
+
+			Stop();
+
+			IFileHandle* FileHandle = FPlatformFileManager::Get().GetPlatformFile().OpenWrite(*InPath);
+			if (!FileHandle)
+			{
+				return false;
+			}
+
+			File.Reset(FileHandle);
+			Path = InPath;
+			StartTime = FPlatformTime::Seconds();
+			StartFrame = GFrameCounter;
+			NumEvents = 0;
+
+			Buffer.Reset(WriteBufferSize);
+			Append(FFileHeader{ FileMagic, FileVersion });
+
+			bCapturing = true;
+			return true;
+		}
+
+		void Stop()
+		{
+			if (!File)
+			{
+				return;
+			}
+
+			bCapturing = false;
+
+			Flush();
+			File.Reset();
+
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("AkGameplayCue capture: %llu cue events written to %s"), NumEvents, *Path);
+
+			Buffer.Empty();
+			ObjectNames.Empty();
+			TagNames.Empty();
+			Actors.Empty();
+			NumNames = 0;
+			NumActors = 0;
+		}
+
+		void Record(EGameplayCueEvent::Type EventType, const UObject* Notify, const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters)
+		{
+			check(IsInGameThread());
+
+			FCueEventRecord Record = {};
+			Record.Time = FPlatformTime::Seconds() - StartTime;
+			Record.Frame = static_cast<uint32>(GFrameCounter - StartFrame);
+			Record.NotifyClass = Notify ? GetObjectName(Notify->GetClass()) : 0;
+			Record.CueTag = GetTagName(CueTag.GetTagName());
+			Record.Target = GetActor(Target);
+			Record.Instigator = GetActor(Parameters.Instigator.Get());
+			Record.EffectCauser = GetActor(Parameters.EffectCauser.Get());
+			Record.PhysicalMaterial = GetObjectName(Parameters.PhysicalMaterial.Get());
+			Record.GameplayEffectLevel = Parameters.GameplayEffectLevel;
+			Record.AbilityLevel = Parameters.AbilityLevel;
+			Record.RawMagnitude = Parameters.RawMagnitude;
+			Record.NormalizedMagnitude = Parameters.NormalizedMagnitude;
+			ToFloats(Parameters.Location, Record.Location);
+			ToFloats(Parameters.Normal, Record.Normal);
+			Record.EventType = static_cast<uint8>(EventType);
+
+			if (IsValid(Target))
+			{
+				ToFloats(Target->GetActorLocation(), Record.TargetLocation);
+
+				const FQuat Rotation = Target->GetActorQuat();
+				Record.TargetRotation[0] = static_cast<float>(Rotation.X);
+				Record.TargetRotation[1] = static_cast<float>(Rotation.Y);
+				Record.TargetRotation[2] = static_cast<float>(Rotation.Z);
+				Record.TargetRotation[3] = static_cast<float>(Rotation.W);
+			}
+			else
+			{
+				Record.TargetRotation[3] = 1.f;
+			}
+
+			Append(ERecordType::CueEvent);
+			Append(Record);
+			++NumEvents;
+
+			if (Buffer.Num() >= WriteBufferSize)
+			{
+				Flush();
+			}
+		}
+
+	private:
+		template <typename T>
+		void Append(const T& Value)
+		{
+			Buffer.Append(reinterpret_cast<const uint8*>(&Value), sizeof(T));
+		}
+
+		static void ToFloats(const FVector& Vector, float (&OutFloats)[3])
+		{
+			OutFloats[0] = static_cast<float>(Vector.X);
+			OutFloats[1] = static_cast<float>(Vector.Y);
+			OutFloats[2] = static_cast<float>(Vector.Z);
+		}
+
+		uint32 AddName(const FString& Name)
+		{
+			const FTCHARToUTF8 Utf8Name(*Name);
+
+			Append(ERecordType::Name);
+			Append(static_cast<uint32>(Utf8Name.Length()));
+			Buffer.Append(reinterpret_cast<const uint8*>(Utf8Name.Get()), Utf8Name.Length());
+
+			return ++NumNames;
+		}
+
+		uint32 GetObjectName(const UObject* Object)
+		{
+			if (!Object)
+			{
+				return 0;
+			}
+
+			if (const uint32* Index = ObjectNames.Find(Object))
+			{
+				return *Index;
+			}
+
+			return ObjectNames.Add(Object, AddName(Object->GetPathName()));
+		}
+
+		uint32 GetTagName(FName TagName)
+		{
+			if (TagName.IsNone())
+			{
+				return 0;
+			}
+
+			if (const uint32* Index = TagNames.Find(TagName))
+			{
+				return *Index;
+			}
+
+			return TagNames.Add(TagName, AddName(TagName.ToString()));
+		}
+
+		uint32 GetActor(const AActor* Actor)
+		{
+			if (!Actor)
+			{
+				return 0;
+			}
+
+			if (const uint32* Index = Actors.Find(Actor))
+			{
+				return *Index;
+			}
+
+			const uint32 ClassName = GetObjectName(Actor->GetClass());
+			Append(ERecordType::Actor);
+			Append(ClassName);
+
+			return Actors.Add(Actor, ++NumActors);
+		}
+
+		void Flush()
+		{
+			if (File && !Buffer.IsEmpty())
+			{
+				File->Write(Buffer.GetData(), Buffer.Num());
+			}
+
+			Buffer.Reset();
+		}
+
+		TUniquePtr<IFileHandle> File;
+		FString Path;
+		TArray<uint8> Buffer;
+
+		TMap<TObjectKey<UObject>, uint32> ObjectNames;
+		TMap<FName, uint32> TagNames;
+		TMap<TObjectKey<AActor>, uint32> Actors;
+		uint32 NumNames = 0;
+		uint32 NumActors = 0;
+
+		double StartTime = 0.0;
+		uint64 StartFrame = 0;
+		uint64 NumEvents = 0;
+	};
+
+	static FRecorder Recorder;
+
+	void RecordCueEvent(EGameplayCueEvent::Type EventType, const UObject* Notify, const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters)
+	{
+		Recorder.Record(EventType, Notify, CueTag, Target, Parameters);
+	}
+
+	/** A capture file, mapped if the platform supports it, loaded otherwise. */
+	class FCaptureFile
+	{
+	public:
+		bool Open(const FString& Path)
+		{
+			IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+			MappedFile.Reset(PlatformFile.OpenMapped(*Path));
+			if (MappedFile)
+			{
+				MappedRegion.Reset(MappedFile->MapRegion());
+			}
+
+			if (MappedRegion)
+			{
+				Data = TConstArrayView<uint8>(MappedRegion->GetMappedPtr(), static_cast<int32>(MappedRegion->GetMappedSize()));
+			}
+			else if (FFileHelper::LoadFileToArray(LoadedData, *Path))
+			{
+				Data = LoadedData;
+			}
+			else
+			{
+				return false;
+			}
+
+			return Parse();
+		}
+
+		FCueEventRecord GetEvent(int32 EventIndex) const
+		{
+			FCueEventRecord Record;
+			FMemory::Memcpy(&Record, Data.GetData() + EventOffsets[EventIndex], sizeof(Record));
+			return Record;
+		}
+
+		int32 GetNumEvents() const
+		{
+			return EventOffsets.Num();
+		}
+
+		/** Names and actor class names, by index.  Index 0 is empty. */
+		TArray<FString> Names;
+		TArray<uint32> ActorClassNames;
+
+	private:
+		bool Parse()
+		{
+			int64 Offset = 0;
+
+			FFileHeader Header;
+			if (!Read(Offset, Header) || (Header.Magic != FileMagic) || (Header.Version != FileVersion))
+			{
+				return false;
+			}
+
+			Names.Add(FString());
+			ActorClassNames.Add(0);
+
+			ERecordType RecordType;
+			while (Read(Offset, RecordType))
+			{
+				if (RecordType == ERecordType::Name)
+				{
+					uint32 Length = 0;
+					if (!Read(Offset, Length) || (Offset + Length > Data.Num()))
+					{
+						break;
+					}
+
+					const auto Name = StringCast<TCHAR>(reinterpret_cast<const UTF8CHAR*>(Data.GetData() + Offset), Length);
+					Names.Add(FString(Name.Length(), Name.Get()));
+					Offset += Length;
+				}
+				else if (RecordType == ERecordType::Actor)
+				{
+					uint32 ClassName = 0;
+					if (!Read(Offset, ClassName))
+					{
+						break;
+					}
+
+					ActorClassNames.Add(ClassName);
+				}
+				else if (RecordType == ERecordType::CueEvent)
+				{
+					if (Offset + static_cast<int64>(sizeof(FCueEventRecord)) > Data.Num())
+					{
+						break;
+					}
+
+					EventOffsets.Add(Offset);
+					Offset += sizeof(FCueEventRecord);
+				}
+				else
+				{
+					return false;
+				}
+			}
+
+			// The last record of a capture that was cut short may be incomplete, everything before it is still good.
+			return true;
+		}
+
+		template <typename T>
+		bool Read(int64& Offset, T& OutValue) const
+		{
+			if (Offset + static_cast<int64>(sizeof(T)) > Data.Num())
+			{
+				return false;
+			}
+
+			FMemory::Memcpy(&OutValue, Data.GetData() + Offset, sizeof(T));
+			Offset += sizeof(T);
+			return true;
+		}
+
+		TUniquePtr<IMappedFileHandle> MappedFile;
+		TUniquePtr<IMappedFileRegion> MappedRegion;
+		TArray<uint8> LoadedData;
+		TConstArrayView<uint8> Data;
+		TArray<int64> EventOffsets;
+	};
+
+	class FReplayRun : public TSharedFromThis<FReplayRun>
+	{
+	public:
+		FReplayRun(UWorld* InWorld, const TArray<FString>& Args)
+			: World(InWorld)
+		{
+			const FString Joined = FString::Join(Args, TEXT(" "));
+
+			FParse::Value(*Joined, TEXT("File="), Path);
+			FParse::Value(*Joined, TEXT("Speed="), Speed);
+			bMaxSpeed = Args.Contains(TEXT("Max"));
+			bQuitWhenDone = Args.Contains(TEXT("Quit"));
+
+			Speed = FMath::Max(Speed, 0.01);
+		}
+
+		bool Start()
+		{
+			if (!Capture.Open(Path))
+			{
+				UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCue replay: Failed to read capture %s"), *Path);
+				return false;
+			}
+
+			ResolveNames();
+			SpawnProxies();
+
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("AkGameplayCue replay: %d cue events on %d actors from %s, %s."),
+				Capture.GetNumEvents(), Proxies.Num() - 1, *Path, bMaxSpeed ? TEXT("one recorded frame per frame") : *FString::Printf(TEXT("%.2fx speed"), Speed));
+
+			StartTime = FPlatformTime::Seconds();
+			TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateSP(this, &FReplayRun::Tick));
+			return true;
+		}
+
+		static TSharedPtr<FReplayRun> ActiveRun;
+
+	private:
+		bool Tick(float DeltaTime)
+		{
+			if (!World.IsValid())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCue replay: World went away, aborting."));
+				ActiveRun.Reset();
+				return false;
+			}
+
+			if (NextEvent >= Capture.GetNumEvents())
+			{
+				Finish();
+				return false;
+			}
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+
+			if (bMaxSpeed)
+			{
+				const uint32 Frame = Capture.GetEvent(NextEvent).Frame;
+				while ((NextEvent < Capture.GetNumEvents()) && (Capture.GetEvent(NextEvent).Frame == Frame))
+				{
+					ReplayEvent(Capture.GetEvent(NextEvent++));
+				}
+			}
+			else
+			{
+				const double ReplayTime = (FPlatformTime::Seconds() - StartTime) * Speed;
+				while ((NextEvent < Capture.GetNumEvents()) && (Capture.GetEvent(NextEvent).Time <= ReplayTime))
+				{
+					ReplayEvent(Capture.GetEvent(NextEvent++));
+				}
+			}
+
+			const uint64 FrameCycles = FPlatformTime::Cycles64() - StartCycles;
+			TotalCycles += FrameCycles;
+			PeakFrameCycles = FMath::Max(PeakFrameCycles, FrameCycles);
+			++NumFrames;
+
+			return true;
+		}
+
+		void ReplayEvent(const FCueEventRecord& Record)
+		{
+			UClass* NotifyClass = NotifyClasses.FindRef(Record.NotifyClass);
+			if (!NotifyClass)
+			{
+				++NumSkipped;
+				return;
+			}
+
+			AActor* Target = GetProxy(Record.Target);
+			if (Target)
+			{
+				const FQuat Rotation(Record.TargetRotation[0], Record.TargetRotation[1], Record.TargetRotation[2], Record.TargetRotation[3]);
+				Target->SetActorLocationAndRotation(ToVector(Record.TargetLocation), Rotation.GetNormalized());
+			}
+
+			const FGameplayTag CueTag = CueTags.FindRef(Record.CueTag);
+
+			FGameplayCueParameters Parameters;
+			Parameters.OriginalTag = CueTag;
+			Parameters.MatchedTagName = CueTag;
+			Parameters.Instigator = GetProxy(Record.Instigator);
+			Parameters.EffectCauser = GetProxy(Record.EffectCauser);
+			Parameters.PhysicalMaterial = PhysicalMaterials.FindRef(Record.PhysicalMaterial);
+			Parameters.GameplayEffectLevel = Record.GameplayEffectLevel;
+			Parameters.AbilityLevel = Record.AbilityLevel;
+			Parameters.RawMagnitude = Record.RawMagnitude;
+			Parameters.NormalizedMagnitude = Record.NormalizedMagnitude;
+			Parameters.Location = ToVector(Record.Location);
+			Parameters.Normal = ToVector(Record.Normal);
+
+			const EGameplayCueEvent::Type EventType = static_cast<EGameplayCueEvent::Type>(Record.EventType);
+
+			// Same as the cue manager: actor notifies get the instance for their target, static ones run on the class default object.
+			if (NotifyClass->IsChildOf<AGameplayCueNotify_Actor>())
+			{
+				UGameplayCueManager* CueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
+				AGameplayCueNotify_Actor* Instance = (CueManager && Target) ? CueManager->GetInstancedCueActor(Target, NotifyClass, Parameters) : nullptr;
+				if (!Instance)
+				{
+					++NumSkipped;
+					return;
+				}
+
+				Instance->HandleGameplayCue(Target, EventType, Parameters);
+			}
+			else if (UGameplayCueNotify_Static* Notify = Cast<UGameplayCueNotify_Static>(NotifyClass->GetDefaultObject()))
+			{
+				Notify->HandleGameplayCue(Target, EventType, Parameters);
+			}
+
+			++NumReplayed;
+		}
+
+		void Finish()
+		{
+			DestroyProxies();
+
+			const double AverageFrameMs = FPlatformTime::ToMilliseconds64(TotalCycles) / FMath::Max<uint64>(NumFrames, 1);
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("AkGameplayCue replay: %llu cue events replayed, %llu skipped, over %llu frames in %.2f s.  Cue time %.3f ms per frame on average, %.3f ms peak."),
+				NumReplayed, NumSkipped, NumFrames, FPlatformTime::Seconds() - StartTime, AverageFrameMs, FPlatformTime::ToMilliseconds64(PeakFrameCycles));
+
+			if (bQuitWhenDone)
+			{
+				FPlatformMisc::RequestExit(false);
+			}
+
+			ActiveRun.Reset();
+		}
+
+		/** Loads everything the events refer to up front, so the replay itself doesn't hitch on loads. */
+		void ResolveNames()
+		{
+			for (int32 EventIndex = 0; EventIndex < Capture.GetNumEvents(); ++EventIndex)
+			{
+				const FCueEventRecord Record = Capture.GetEvent(EventIndex);
+
+				if (Capture.Names.IsValidIndex(Record.NotifyClass) && !NotifyClasses.Contains(Record.NotifyClass))
+				{
+					UClass* NotifyClass = LoadClass<UObject>(nullptr, *Capture.Names[Record.NotifyClass]);
+					if (!NotifyClass)
+					{
+						UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCue replay: Notify class %s not found, its events are skipped."), *Capture.Names[Record.NotifyClass]);
+					}
+
+					NotifyClasses.Add(Record.NotifyClass, NotifyClass);
+					LoadedObjects.Emplace(NotifyClass);
+				}
+
+				if (Capture.Names.IsValidIndex(Record.CueTag) && !CueTags.Contains(Record.CueTag))
+				{
+					CueTags.Add(Record.CueTag, FGameplayTag::RequestGameplayTag(FName(Capture.Names[Record.CueTag]), false));
+				}
+
+				if (Capture.Names.IsValidIndex(Record.PhysicalMaterial) && !PhysicalMaterials.Contains(Record.PhysicalMaterial))
+				{
+					UPhysicalMaterial* PhysicalMaterial = LoadObject<UPhysicalMaterial>(nullptr, *Capture.Names[Record.PhysicalMaterial]);
+					PhysicalMaterials.Add(Record.PhysicalMaterial, PhysicalMaterial);
+					LoadedObjects.Emplace(PhysicalMaterial);
+				}
+			}
+		}
+
+		/** Every recorded actor gets a plain stand-in, the notifies only need something to attach to and read a transform from. */
+		void SpawnProxies()
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.ObjectFlags |= RF_Transient;
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			Proxies.Add(nullptr);
+			for (int32 ActorIndex = 1; ActorIndex < Capture.ActorClassNames.Num(); ++ActorIndex)
+			{
+				AActor* Proxy = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+
+				USceneComponent* Root = NewObject<USceneComponent>(Proxy, TEXT("Root"));
+				Root->SetMobility(EComponentMobility::Movable);
+				Proxy->SetRootComponent(Root);
+				Root->RegisterComponent();
+
+				Proxies.Add(Proxy);
+			}
+		}
+
+		void DestroyProxies()
+		{
+			for (AActor* Proxy : Proxies)
+			{
+				if (IsValid(Proxy))
+				{
+					Proxy->Destroy();
+				}
+			}
+
+			Proxies.Reset();
+		}
+
+		AActor* GetProxy(uint32 ActorIndex) const
+		{
+			return Proxies.IsValidIndex(ActorIndex) ? Proxies[ActorIndex] : nullptr;
+		}
+
+		static FVector ToVector(const float (&Floats)[3])
+		{
+			return FVector(Floats[0], Floats[1], Floats[2]);
+		}
+
+		TWeakObjectPtr<UWorld> World;
+		FCaptureFile Capture;
+
+		TMap<uint32, UClass*> NotifyClasses;
+		TMap<uint32, FGameplayTag> CueTags;
+		TMap<uint32, UPhysicalMaterial*> PhysicalMaterials;
+		TArray<AActor*> Proxies;
+
+		/** Keeps the loaded classes and materials alive for the duration of the replay. */
+		TArray<TStrongObjectPtr<UObject>> LoadedObjects;
+
+		FString Path;
+		double Speed = 1.0;
+		bool bMaxSpeed = false;
+		bool bQuitWhenDone = false;
+
+		int32 NextEvent = 0;
+		double StartTime = 0.0;
+		uint64 NumReplayed = 0;
+		uint64 NumSkipped = 0;
+		uint64 NumFrames = 0;
+		uint64 TotalCycles = 0;
+		uint64 PeakFrameCycles = 0;
+
+		FTSTicker::FDelegateHandle TickerHandle;
+	};
+
+	TSharedPtr<FReplayRun> FReplayRun::ActiveRun;
+
+	static FAutoConsoleCommandWithArgs CaptureCommand(
+		TEXT("AkGameplayCue.Capture"),
+		TEXT("Start [File=<file>] records all Ak gameplay cue events to a capture file, Stop finishes it."),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			if (Args.Contains(TEXT("Stop")))
+			{
+				Recorder.Stop();
+				return;
+			}
+
+			if (FReplayRun::ActiveRun.IsValid())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCue capture: Can't capture while a replay is running."));
+				return;
+			}
+
+			FString Path;
+			if (!FParse::Value(*FString::Join(Args, TEXT(" ")), TEXT("File="), Path))
+			{
+				Path = FPaths::ProjectSavedDir() / TEXT("AkGameplayCues") / TEXT("Captures") / FString::Printf(TEXT("Capture-%s.akgc"), *FDateTime::Now().ToString());
+			}
+
+			IFileManager::Get().MakeDirectory(*FPaths::GetPath(Path), true);
+
+			if (Recorder.Start(Path))
+			{
+				UE_LOG(LogAkGameplayCueNotify, Display, TEXT("AkGameplayCue capture: Recording to %s"), *Path);
+			}
+			else
+			{
+				UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCue capture: Failed to open %s"), *Path);
+			}
+		}));
+
+	static FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("AkGameplayCue.Replay"),
+		TEXT("Replays an Ak gameplay cue capture in the current world. See AkGameplayCueCapture.cpp for arguments."),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (!World || !World->IsGameWorld())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCue replay: Needs a game world."));
+				return;
+			}
+
+			if (FReplayRun::ActiveRun.IsValid())
+			{
+				UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCue replay: Already running."));
+				return;
+			}
+
+			// Replayed events would be captured again.
+			Recorder.Stop();
+
+			FReplayRun::ActiveRun = MakeShared<FReplayRun>(World, Args);
+			if (!FReplayRun::ActiveRun->Start())
+			{
+				FReplayRun::ActiveRun.Reset();
+			}
+		}));
+}
+
+#endif
@@ -0,0 +1,35 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayCueInterface.h"
+
+#define AK_GAMEPLAY_CUE_CAPTURE_ENABLED (!UE_BUILD_SHIPPING)
+
+class AActor;
+struct FGameplayCueParameters;
+struct FGameplayTag;
+
+#if AK_GAMEPLAY_CUE_CAPTURE_ENABLED
+
+namespace AkGameplayCueCapture
+{
+	/** Set while AkGameplayCue.Capture is recording, so the hooks cost a single branch otherwise. */
+	extern bool bCapturing;
+
+	/** Appends a cue event to the capture file.  Game thread only. */
+	void RecordCueEvent(EGameplayCueEvent::Type EventType, const UObject* Notify, const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters);
+}
+
+#define AK_GAMEPLAY_CUE_CAPTURE_EVENT(EventType, Notify, CueTag, Target, Parameters) \
+	if (AkGameplayCueCapture::bCapturing) \
+	{ \
+		AkGameplayCueCapture::RecordCueEvent(EventType, Notify, CueTag, Target, Parameters); \
+	}
+
+#else
+
+#define AK_GAMEPLAY_CUE_CAPTURE_EVENT(EventType, Notify, CueTag, Target, Parameters)
+
+#endif
@@ -0,0 +1,14 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueCountingMalloc.h"
+
+#if !UE_BUILD_SHIPPING
+
+FAkGameplayCueCountingMalloc& FAkGameplayCueCountingMalloc::Get()
+{
+	static FAkGameplayCueCountingMalloc CountingMalloc;
+	return CountingMalloc;
+}
+
+#endif
@@ -0,0 +1,146 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueTypes.h"
+
+#if !UE_BUILD_SHIPPING
+
+/**
+ * FAkGameplayCueCountingMalloc
+ *
+ *	Counts game thread allocations by wrapping GMalloc while installed.  Used by the benchmark and the allocation tests.
+ *	Best effort: allocations that bypass GMalloc aren't seen.  Builds where FMemory doesn't go through GMalloc at all
+ *	are caught by a sanity check on first install, CountsAllocations is false there.
+ */
+class FAkGameplayCueCountingMalloc final : public FMalloc
+{
+public:
+	/** Lives for the whole process, stale GMalloc readers may still call into it after uninstalling. */
+	static FAkGameplayCueCountingMalloc& Get();
+
+	void Install()
+	{
+		check(IsInGameThread() && !bInstalled);
+
+		// Other threads keep allocating while GMalloc is swapped.
+		InnerMalloc = static_cast<FMalloc*>(FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), this));
+		bInstalled = true;
+
+		if (!bSanityChecked)
+		{
+			bSanityChecked = true;
+
+			const uint64 StartAllocations = NumAllocations;
+			FMemory::Free(FMemory::Malloc(16));
+			bCountsAllocations = (NumAllocations > StartAllocations);
+
+			if (!bCountsAllocations)
+			{
+				UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCueCountingMalloc: FMemory doesn't allocate through GMalloc in this build, allocation counts are unavailable."));
+			}
+		}
+	}
+
+	void Uninstall()
+	{
+		check(IsInGameThread() && bInstalled);
+
+		// Keep InnerMalloc, callers that already fetched GMalloc may still come through here.
+		FPlatformAtomics::InterlockedExchangePtr(reinterpret_cast<void**>(&GMalloc), InnerMalloc);
+		bInstalled = false;
+	}
+
+	uint64 GetNumAllocations() const
+	{
+		return NumAllocations;
+	}
+
+	/** False if the sanity check found that allocations bypass GMalloc, a count of 0 would be meaningless. */
+	bool CountsAllocations() const
+	{
+		return bCountsAllocations;
+	}
+
+	//~ Begin FMalloc Interface
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		CountAllocation();
+		return InnerMalloc->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			CountAllocation();
+		}
+
+		return InnerMalloc->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		if (Count > 0)
+		{
+			CountAllocation();
+		}
+
+		return InnerMalloc->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override
+	{
+		InnerMalloc->Free(Original);
+	}
+
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+	{
+		return InnerMalloc->QuantizeSize(Count, Alignment);
+	}
+
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+	{
+		return InnerMalloc->GetAllocationSize(Original, SizeOut);
+	}
+
+	virtual void Trim(bool bTrimThreadCaches) override
+	{
+		InnerMalloc->Trim(bTrimThreadCaches);
+	}
+
+	virtual bool IsInternallyThreadSafe() const override
+	{
+		return InnerMalloc->IsInternallyThreadSafe();
+	}
+
+	virtual const TCHAR* GetDescriptiveName() override
+	{
+		return TEXT("AkGameplayCueCountingMalloc");
+	}
+	//~ End FMalloc Interface
+
+private:
+	void CountAllocation()
+	{
+		if (IsInGameThread())
+		{
+			++NumAllocations;
+		}
+	}
+
+	FMalloc* InnerMalloc = nullptr;
+	uint64 NumAllocations = 0;
+	bool bInstalled = false;
+	bool bSanityChecked = false;
+	bool bCountsAllocations = false;
+};
+
+#endif
@@ -0,0 +1,80 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueDuplicateFilter.h"
+
+#include "AkGameplayCueStats.h"
+#include "GameFramework/Actor.h"
+#include "GameplayEffectTypes.h"
+#include "Hash/CityHash.h"
+
+namespace AkGameplayCueDuplicateFilter
+{
+	/** Predicted and replicated locations differ slightly, so locations are compared on a coarse grid. */
+	constexpr double LocationCellSize = 100.0;
+}
+
+uint64 FAkGameplayCueDuplicateFilter::MakeKey(const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters)
+{
+	// Only what is the same on the predicting client and the server, the effect context is a different object on each.
+	uint64 Key = CityHash64WithSeed(reinterpret_cast<const char*>(&Target), sizeof(Target), GetTypeHash(CueTag));
+
+	const UObject* KeyObjects[] = { Parameters.Instigator.Get(), Parameters.EffectCauser.Get(), Parameters.SourceObject.Get() };
+	Key = CityHash64WithSeed(reinterpret_cast<const char*>(KeyObjects), sizeof(KeyObjects), Key);
+
+	const FIntVector Cell(
+		FMath::FloorToInt32(Parameters.Location.X / AkGameplayCueDuplicateFilter::LocationCellSize),
+		FMath::FloorToInt32(Parameters.Location.Y / AkGameplayCueDuplicateFilter::LocationCellSize),
+		FMath::FloorToInt32(Parameters.Location.Z / AkGameplayCueDuplicateFilter::LocationCellSize));
+	const int32 Levels[] = { Cell.X, Cell.Y, Cell.Z, Parameters.GameplayEffectLevel, Parameters.AbilityLevel };
+	Key = CityHash64WithSeed(reinterpret_cast<const char*>(Levels), sizeof(Levels), Key);
+
+	return (Key != 0) ? Key : 1;
+}
+
+void FAkGameplayCueDuplicateFilter::Record(uint64 Key, double Now, float WindowSeconds)
+{
+	check(IsInGameThread());
+
+	FRecord* Replaced = nullptr;
+	for (int32 Probe = 0; Probe < MaxProbes; ++Probe)
+	{
+		FRecord& Record = Records[(Key + Probe) & (NumRecords - 1)];
+
+		// Free and expired records expire before any live one.
+		if (!Replaced || (Record.ExpireTime < Replaced->ExpireTime))
+		{
+			Replaced = &Record;
+		}
+	}
+
+	Replaced->Key = Key;
+	Replaced->ExpireTime = Now + FMath::Max(WindowSeconds, 0.f);
+}
+
+bool FAkGameplayCueDuplicateFilter::Consume(uint64 Key, double Now)
+{
+	check(IsInGameThread());
+
+	for (int32 Probe = 0; Probe < MaxProbes; ++Probe)
+	{
+		FRecord& Record = Records[(Key + Probe) & (NumRecords - 1)];
+		if ((Record.Key == Key) && (Record.ExpireTime >= Now))
+		{
+			Record = FRecord();
+			++NumSuppressed;
+			AkGameplayCueStats::RecordSuppressedDuplicate();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FAkGameplayCueDuplicateFilter::Reset()
+{
+	for (FRecord& Record : Records)
+	{
+		Record = FRecord();
+	}
+}
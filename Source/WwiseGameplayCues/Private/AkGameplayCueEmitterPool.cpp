@@ -0,0 +1,260 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueEmitterPool.h"
+
+#include "AkAudioDevice.h"
+#include "AkAudioEvent.h"
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueTypes.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+namespace AkGameplayCueEmitterPool
+{
+	/** The integration uses object addresses as game object IDs, pooled emitters live far above any address. */
+	constexpr AkGameObjectID FirstGameObjectID = 0xAC00000000000000ull;
+
+	/** Shared by all worlds so emitters of different worlds never collide.  Game thread only. */
+	static uint64 NextEmitterIndex = 0;
+}
+
+void FAkGameplayCueEmitterPool::Initialize()
+{
+	const UAkGameplayCueSettings* Settings = UAkGameplayCueSettings::Get();
+	if (!Settings->bUseEmitterPool)
+	{
+		return;
+	}
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		UE_LOG(LogAkGameplayCueNotify, Log, TEXT("AkGameplayCueNotify: Sound engine is not initialized, emitter pool is disabled."));
+		return;
+	}
+
+	bInitialized = true;
+
+	Emitters.Reserve(Settings->EmitterPoolSize);
+	FreeEmitters.Reserve(Settings->EmitterPoolSize);
+
+	for (int32 Index = 0; Index < Settings->EmitterPoolSize; ++Index)
+	{
+		if (!RegisterEmitter())
+		{
+			break;
+		}
+	}
+}
+
+void FAkGameplayCueEmitterPool::Deinitialize()
+{
+	if (!bInitialized)
+	{
+		return;
+	}
+
+	bInitialized = false;
+
+	// Queued posts point at the end of event queue.
+	FAkGameplayCueAsyncPoster::Get().Flush();
+	EndOfEventQueue.CancelCallbacks();
+
+	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get(); SoundEngine && SoundEngine->IsInitialized())
+	{
+		for (const FEmitter& Emitter : Emitters)
+		{
+			SoundEngine->StopAll(Emitter.GameObjectID);
+			SoundEngine->UnregisterGameObj(Emitter.GameObjectID);
+		}
+	}
+
+	Emitters.Empty();
+	FreeEmitters.Empty();
+	GameObjectToEmitter.Empty();
+	Stats = FAkGameplayCueEmitterPoolStats();
+}
+
+bool FAkGameplayCueEmitterPool::PostAtLocation(const UAkAudioEvent* Event, const FTransform& Transform, AkPlayingID& OutPlayingID, AkGameObjectID* OutGameObjectID, const FAkGameplayCueBoundParameters* BoundParameters)
+{
+	OutPlayingID = AK_INVALID_PLAYING_ID;
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!bInitialized || !SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return false;
+	}
+
+	++Stats.NumRequests;
+
+	if (FreeEmitters.IsEmpty())
+	{
+		const UAkGameplayCueSettings* Settings = UAkGameplayCueSettings::Get();
+		const bool bCanGrow = (Settings->EmitterPoolOverflowPolicy == EAkGameplayCueEmitterPoolOverflowPolicy::Grow) && (Emitters.Num() < Settings->MaxEmitterPoolSize);
+
+		if (bCanGrow && RegisterEmitter())
+		{
+			++Stats.NumGrows;
+		}
+		else
+		{
+			++Stats.NumOverflows;
+
+			// Rejected posts are handled (with an invalid ID), everything else falls back to a transient game object.
+			if (Settings->EmitterPoolOverflowPolicy == EAkGameplayCueEmitterPoolOverflowPolicy::Reject)
+			{
+				AkGameplayCueStats::RecordRejectedPost();
+				return true;
+			}
+
+			return false;
+		}
+	}
+	else
+	{
+		++Stats.NumHits;
+	}
+
+	const int32 EmitterIndex = FreeEmitters.Pop(EAllowShrinking::No);
+	FEmitter& Emitter = Emitters[EmitterIndex];
+	Emitter.bSwitchesSet |= (BoundParameters && !BoundParameters->Switches.IsEmpty());
+
+	AkSoundPosition SoundPosition;
+	FAkAudioDevice::FVectorsToAKWorldTransform(Transform.GetLocation(), Transform.GetUnitAxis(EAxis::X), Transform.GetUnitAxis(EAxis::Z), SoundPosition);
+
+	// The emitter is taken right away, a failed async post hands it back through the end of event queue.
+	FAkGameplayCueAsyncPoster& AsyncPoster = FAkGameplayCueAsyncPoster::Get();
+	if (AsyncPoster.IsEnabled())
+	{
+		FAkGameplayCueAsyncPost Post;
+		Post.EventID = Event->GetShortID();
+		Post.GameObjectID = Emitter.GameObjectID;
+		Post.Position = SoundPosition;
+		Post.CallbackFlags = AK_EndOfEvent;
+		Post.Callback = &FAkGameplayCueEndOfEventQueue::OnEventCallback;
+		Post.Cookie = EndOfEventQueue.GetCookie();
+		Post.FailureQueue = &EndOfEventQueue;
+
+		if (BoundParameters)
+		{
+			Post.BoundParameters = *BoundParameters;
+		}
+
+		OutPlayingID = AsyncPoster.Submit(MoveTemp(Post), Event->IsInfinite);
+	}
+	else
+	{
+		SoundEngine->SetPosition(Emitter.GameObjectID, SoundPosition);
+
+		if (BoundParameters)
+		{
+			BoundParameters->ApplySwitches(Emitter.GameObjectID);
+		}
+
+		OutPlayingID = SoundEngine->PostEvent(
+			Event->GetShortID(),
+			Emitter.GameObjectID,
+			AK_EndOfEvent,
+			&FAkGameplayCueEndOfEventQueue::OnEventCallback,
+			EndOfEventQueue.GetCookie());
+	}
+
+	if (OutPlayingID == AK_INVALID_PLAYING_ID)
+	{
+		// No end of event callback will come for a failed post.
+		if (Emitter.bSwitchesSet)
+		{
+			ResetSwitches(Emitter);
+		}
+
+		FreeEmitters.Push(EmitterIndex);
+		return true;
+	}
+
+	++Emitter.NumActiveEvents;
+	++Stats.NumInUse;
+	Stats.PeakInUse = FMath::Max(Stats.PeakInUse, Stats.NumInUse);
+
+	if (OutGameObjectID)
+	{
+		*OutGameObjectID = Emitter.GameObjectID;
+	}
+
+	return true;
+}
+
+void FAkGameplayCueEmitterPool::ProcessFinishedEvents(TArray<AkPlayingID>* OutFinishedPlayingIDs, TArray<AkGameObjectID>* OutReleasedEmitters)
+{
+	FAkGameplayCueFinishedEvent FinishedEvent;
+	while (EndOfEventQueue.Dequeue(FinishedEvent))
+	{
+		if (OutFinishedPlayingIDs)
+		{
+			OutFinishedPlayingIDs->Add(FinishedEvent.PlayingID);
+		}
+
+		if (const int32* EmitterIndex = GameObjectToEmitter.Find(FinishedEvent.GameObjectID))
+		{
+			FEmitter& Emitter = Emitters[*EmitterIndex];
+			if (ensure(Emitter.NumActiveEvents > 0) && (--Emitter.NumActiveEvents == 0))
+			{
+				ReleaseEmitter(*EmitterIndex);
+
+				if (OutReleasedEmitters)
+				{
+					OutReleasedEmitters->Add(Emitter.GameObjectID);
+				}
+			}
+		}
+	}
+}
+
+bool FAkGameplayCueEmitterPool::RegisterEmitter()
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return false;
+	}
+
+	const AkGameObjectID GameObjectID = AkGameplayCueEmitterPool::FirstGameObjectID + AkGameplayCueEmitterPool::NextEmitterIndex++;
+	if (SoundEngine->RegisterGameObj(GameObjectID, "AkGameplayCueEmitter") != AK_Success)
+	{
+		return false;
+	}
+
+	const int32 EmitterIndex = Emitters.Add({ GameObjectID, 0, false });
+	GameObjectToEmitter.Add(GameObjectID, EmitterIndex);
+	FreeEmitters.Push(EmitterIndex);
+
+	Stats.NumEmitters = Emitters.Num();
+
+	return true;
+}
+
+void FAkGameplayCueEmitterPool::ReleaseEmitter(int32 EmitterIndex)
+{
+	FEmitter& Emitter = Emitters[EmitterIndex];
+	if (Emitter.bSwitchesSet)
+	{
+		ResetSwitches(Emitter);
+	}
+
+	FreeEmitters.Push(EmitterIndex);
+	--Stats.NumInUse;
+}
+
+void FAkGameplayCueEmitterPool::ResetSwitches(FEmitter& Emitter)
+{
+	Emitter.bSwitchesSet = false;
+
+	// Switches can't be unset, but a freshly registered game object has every switch group at its default.
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (SoundEngine && SoundEngine->IsInitialized())
+	{
+		SoundEngine->UnregisterGameObj(Emitter.GameObjectID);
+		SoundEngine->RegisterGameObj(Emitter.GameObjectID, "AkGameplayCueEmitter");
+	}
+}
@@ -0,0 +1,126 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueEmitterUpdater.h"
+
+#include "AkAudioDevice.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "Components/SceneComponent.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+namespace AkGameplayCueEmitterUpdater
+{
+	/** Moves smaller than this (in cm) aren't sent to the sound engine. */
+	constexpr double MinMoveDistanceSquared = 1.0;
+
+	constexpr double MinRotationDelta = 1.e-4;
+}
+
+void FAkGameplayCueEmitterUpdater::Add(AkGameObjectID GameObjectID, const USceneComponent* FollowComponent, const FTransform& SpawnTransform, float UpdateInterval, double Now)
+{
+	check(IsInGameThread());
+
+	if (!FollowComponent || (GameObjectID == AK_INVALID_GAME_OBJECT))
+	{
+		return;
+	}
+
+	// A pooled emitter is only handed out again after it was taken back, anything still following it is stale.
+	FollowedEmitters.RemoveAllSwap([GameObjectID](const FFollowedEmitter& FollowedEmitter)
+	{
+		return FollowedEmitter.GameObjectID == GameObjectID;
+	}, EAllowShrinking::No);
+
+	FFollowedEmitter& FollowedEmitter = FollowedEmitters.AddDefaulted_GetRef();
+	FollowedEmitter.GameObjectID = GameObjectID;
+	FollowedEmitter.FollowComponent = FollowComponent;
+	FollowedEmitter.RelativeTransform = SpawnTransform.GetRelativeTransform(FollowComponent->GetComponentTransform());
+	FollowedEmitter.LastTransform = SpawnTransform;
+	FollowedEmitter.NextUpdateTime = Now + UpdateInterval;
+	FollowedEmitter.UpdateInterval = FMath::Max(UpdateInterval, 0.f);
+}
+
+void FAkGameplayCueEmitterUpdater::Remove(TConstArrayView<AkGameObjectID> GameObjectIDs)
+{
+	if (GameObjectIDs.IsEmpty() || FollowedEmitters.IsEmpty())
+	{
+		return;
+	}
+
+	FollowedEmitters.RemoveAllSwap([GameObjectIDs](const FFollowedEmitter& FollowedEmitter)
+	{
+		return GameObjectIDs.Contains(FollowedEmitter.GameObjectID);
+	}, EAllowShrinking::No);
+}
+
+void FAkGameplayCueEmitterUpdater::Tick(double Now, TConstArrayView<FVector> ListenerLocations)
+{
+	if (FollowedEmitters.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_UpdateEmitterPositions);
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return;
+	}
+
+	const UAkGameplayCueSettings* Settings = UAkGameplayCueSettings::Get();
+	const double ThrottleDistanceSquared = FMath::Square(static_cast<double>(Settings->FollowThrottleDistance));
+	const float ThrottledUpdateInterval = Settings->FollowThrottledUpdateInterval;
+
+	for (int32 Index = FollowedEmitters.Num() - 1; Index >= 0; --Index)
+	{
+		FFollowedEmitter& FollowedEmitter = FollowedEmitters[Index];
+		if (Now < FollowedEmitter.NextUpdateTime)
+		{
+			continue;
+		}
+
+		// The emitter stays where its target was last seen.
+		const USceneComponent* FollowComponent = FollowedEmitter.FollowComponent.Get();
+		if (!FollowComponent)
+		{
+			FollowedEmitters.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		const FTransform Transform = FollowedEmitter.RelativeTransform * FollowComponent->GetComponentTransform();
+		const FVector Location = Transform.GetLocation();
+
+		bool bThrottled = (ThrottleDistanceSquared > 0.0);
+		for (const FVector& ListenerLocation : ListenerLocations)
+		{
+			if (FVector::DistSquared(ListenerLocation, Location) <= ThrottleDistanceSquared)
+			{
+				bThrottled = false;
+				break;
+			}
+		}
+
+		FollowedEmitter.NextUpdateTime = Now + (bThrottled ? FMath::Max(FollowedEmitter.UpdateInterval, ThrottledUpdateInterval) : FollowedEmitter.UpdateInterval);
+
+		const bool bMoved = (FVector::DistSquared(FollowedEmitter.LastTransform.GetLocation(), Location) >= AkGameplayCueEmitterUpdater::MinMoveDistanceSquared)
+			|| !FollowedEmitter.LastTransform.GetRotation().Equals(Transform.GetRotation(), AkGameplayCueEmitterUpdater::MinRotationDelta);
+
+		if (!bMoved)
+		{
+			continue;
+		}
+
+		FollowedEmitter.LastTransform = Transform;
+
+		AkSoundPosition SoundPosition;
+		FAkAudioDevice::FVectorsToAKWorldTransform(Location, Transform.GetUnitAxis(EAxis::X), Transform.GetUnitAxis(EAxis::Z), SoundPosition);
+		SoundEngine->SetPosition(FollowedEmitter.GameObjectID, SoundPosition);
+	}
+}
+
+void FAkGameplayCueEmitterUpdater::Reset()
+{
+	FollowedEmitters.Empty();
+}
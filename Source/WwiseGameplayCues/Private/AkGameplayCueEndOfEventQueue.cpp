@@ -0,0 +1,40 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueEndOfEventQueue.h"
+
+#include "AkAudioDevice.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+FAkGameplayCueEndOfEventQueue::~FAkGameplayCueEndOfEventQueue()
+{
+	CancelCallbacks();
+}
+
+void FAkGameplayCueEndOfEventQueue::OnEventCallback(AkCallbackType CallbackType, AkCallbackInfo* CallbackInfo)
+{
+	if ((CallbackType != AK_EndOfEvent) || !CallbackInfo || !CallbackInfo->pCookie)
+	{
+		return;
+	}
+
+	const AkEventCallbackInfo* EventInfo = static_cast<AkEventCallbackInfo*>(CallbackInfo);
+	FAkGameplayCueEndOfEventQueue* Queue = static_cast<FAkGameplayCueEndOfEventQueue*>(CallbackInfo->pCookie);
+	Queue->FinishedEvents.Enqueue({ EventInfo->playingID, EventInfo->gameObjID });
+}
+
+void FAkGameplayCueEndOfEventQueue::CancelCallbacks()
+{
+	// Posts through the audio device wrap the cookie into a callback package of its own, which the raw cancel below doesn't match.
+	if (FAkAudioDevice* AudioDevice = FAkAudioDevice::Get())
+	{
+		AudioDevice->CancelEventCallbackCookie(GetCookie());
+	}
+
+	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get(); SoundEngine && SoundEngine->IsInitialized())
+	{
+		SoundEngine->CancelEventCallbackCookie(GetCookie());
+	}
+
+	FinishedEvents.Empty();
+}
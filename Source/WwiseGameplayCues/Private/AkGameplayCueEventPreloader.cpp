@@ -0,0 +1,313 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueEventPreloader.h"
+
+#include "AbilitySystemGlobals.h"
+#include "AkAudioEvent.h"
+#include "AkGameplayCueNotify_Burst.h"
+#include "AkGameplayCueNotify_BurstLatent.h"
+#include "AkGameplayCueNotify_BurstSequence.h"
+#include "AkGameplayCueNotify_Looping.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueTypes.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameplayCueManager.h"
+#include "GameplayCueSet.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+static FAutoConsoleCommand DumpPreloadStateCommand(
+	TEXT("AkGameplayCue.DumpPreloadState"),
+	TEXT("Logs the load and prepare state of all Ak events prefetched for gameplay cues."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FAkGameplayCueEventPreloader::Get().Dump();
+	}));
+
+FAkGameplayCueEventPreloader& FAkGameplayCueEventPreloader::Get()
+{
+	static FAkGameplayCueEventPreloader Preloader;
+	return Preloader;
+}
+
+void FAkGameplayCueEventPreloader::Initialize()
+{
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FAkGameplayCueEventPreloader::OnPostLoadMapWithWorld);
+	WorldCleanupHandle = FWorldDelegates::OnWorldCleanup.AddRaw(this, &FAkGameplayCueEventPreloader::OnWorldCleanup);
+}
+
+void FAkGameplayCueEventPreloader::Shutdown()
+{
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	FWorldDelegates::OnWorldCleanup.Remove(WorldCleanupHandle);
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	ReleaseAllRequests();
+	QueuedPosts.Empty();
+}
+
+void FAkGameplayCueEventPreloader::Prefetch(const TSoftObjectPtr<UAkAudioEvent>& Event)
+{
+	if (!Event.IsNull())
+	{
+		FindOrAddRequest(Event);
+	}
+}
+
+void FAkGameplayCueEventPreloader::PrefetchNotifyClass(const UClass* NotifyClass)
+{
+	if (!NotifyClass)
+	{
+		return;
+	}
+
+	if (NotifyClass->IsChildOf<UAkGameplayCueNotify_Burst>())
+	{
+		NotifyClass->GetDefaultObject<UAkGameplayCueNotify_Burst>()->PrefetchAkEvents();
+	}
+	else if (NotifyClass->IsChildOf<UAkGameplayCueNotify_BurstSequence>())
+	{
+		NotifyClass->GetDefaultObject<UAkGameplayCueNotify_BurstSequence>()->PrefetchAkEvents();
+	}
+	else if (NotifyClass->IsChildOf<AAkGameplayCueNotify_BurstLatent>())
+	{
+		NotifyClass->GetDefaultObject<AAkGameplayCueNotify_BurstLatent>()->PrefetchAkEvents();
+	}
+	else if (NotifyClass->IsChildOf<AAkGameplayCueNotify_Looping>())
+	{
+		NotifyClass->GetDefaultObject<AAkGameplayCueNotify_Looping>()->PrefetchAkEvents();
+	}
+}
+
+UAkAudioEvent* FAkGameplayCueEventPreloader::GetReadyEvent(const TSoftObjectPtr<UAkAudioEvent>& Event)
+{
+	// Prepared or not, a loaded event is playable, the integration loaded its media with the asset.
+	// Prepare it anyway (if not done already), so it stays resident for as long as the cues need it.
+	Prefetch(Event);
+	return Event.Get();
+}
+
+void FAkGameplayCueEventPreloader::QueuePost(
+	const TSoftObjectPtr<UAkAudioEvent>& Event,
+	UWorld* World,
+	AActor* TargetActor,
+	const FTransform& SpawnTransform,
+	bool bAttachToTarget)
+{
+	Prefetch(Event);
+
+	FQueuedPost& QueuedPost = QueuedPosts.AddDefaulted_GetRef();
+	QueuedPost.Event = Event;
+	QueuedPost.World = World;
+	QueuedPost.TargetActor = TargetActor;
+	QueuedPost.SpawnTransform = SpawnTransform;
+	QueuedPost.QueueTime = FPlatformTime::Seconds();
+	QueuedPost.bAttachToTarget = bAttachToTarget;
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAkGameplayCueEventPreloader::TickQueuedPosts));
+	}
+}
+
+void FAkGameplayCueEventPreloader::Dump() const
+{
+	int32 NumPrepared = 0;
+	for (const TPair<FSoftObjectPath, TUniquePtr<FRequest>>& Pair : Requests)
+	{
+		const bool bLoaded = (Pair.Key.ResolveObject() != nullptr);
+		const bool bPrepared = Pair.Value->bPrepared;
+		NumPrepared += bPrepared ? 1 : 0;
+
+		UE_LOG(LogAkGameplayCueNotify, Display, TEXT("  %s: %s, %s"), *Pair.Key.ToString(), bLoaded ? TEXT("loaded") : TEXT("loading"), bPrepared ? TEXT("prepared") : TEXT("preparing"));
+	}
+
+	UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Ak gameplay cue preloader: %d of %d events ready, %d queued posts."), NumPrepared, Requests.Num(), QueuedPosts.Num());
+}
+
+FAkGameplayCueEventPreloader::FRequest& FAkGameplayCueEventPreloader::FindOrAddRequest(const TSoftObjectPtr<UAkAudioEvent>& Event)
+{
+	const FSoftObjectPath& EventPath = Event.ToSoftObjectPath();
+	if (TUniquePtr<FRequest>* ExistingRequest = Requests.Find(EventPath))
+	{
+		return **ExistingRequest;
+	}
+
+	FRequest* Request = Requests.Add(EventPath, MakeUnique<FRequest>()).Get();
+	Request->LoadHandle = StreamableManager.RequestAsyncLoad(
+		EventPath,
+		FStreamableDelegate::CreateRaw(this, &FAkGameplayCueEventPreloader::OnEventLoaded, Request, EventPath));
+
+	return *Request;
+}
+
+void FAkGameplayCueEventPreloader::OnEventLoaded(FRequest* Request, FSoftObjectPath EventPath)
+{
+	const UAkAudioEvent* Event = Cast<UAkAudioEvent>(EventPath.ResolveObject());
+	if (!Event)
+	{
+		UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCueNotify: Failed to load Ak event [%s]."), *EventPath.ToString());
+		Request->bPrepared = true;
+		return;
+	}
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		Request->bPrepared = true;
+		return;
+	}
+
+	// Prepare the media in the background.  A failed prepare only means the post may stream its media in, so it counts as ready too.
+	Request->PreparedEventID = Event->GetShortID();
+	if (SoundEngine->PrepareEvent(AK::SoundEngine::Preparation_Load, &Request->PreparedEventID, 1, &FAkGameplayCueEventPreloader::OnEventPrepared, Request) != AK_Success)
+	{
+		Request->bPrepared = true;
+	}
+}
+
+void FAkGameplayCueEventPreloader::ReleaseRequest(FRequest& Request, IWwiseSoundEngineAPI* SoundEngine)
+{
+	if (SoundEngine)
+	{
+		SoundEngine->CancelBankCallbackCookie(&Request);
+
+		// A prepare still in flight is undone too, the sound engine processes both in order.
+		if ((Request.PreparedEventID != AK_INVALID_UNIQUE_ID) && (!Request.bPrepared || Request.bPrepareSucceeded))
+		{
+			SoundEngine->PrepareEvent(AK::SoundEngine::Preparation_Unload, &Request.PreparedEventID, 1, nullptr, nullptr);
+		}
+	}
+
+	if (Request.LoadHandle.IsValid())
+	{
+		Request.LoadHandle->CancelHandle();
+	}
+}
+
+void FAkGameplayCueEventPreloader::ReleaseAllRequests()
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (SoundEngine && !SoundEngine->IsInitialized())
+	{
+		SoundEngine = nullptr;
+	}
+
+	for (TPair<FSoftObjectPath, TUniquePtr<FRequest>>& Pair : Requests)
+	{
+		ReleaseRequest(*Pair.Value, SoundEngine);
+	}
+
+	Requests.Empty();
+}
+
+void FAkGameplayCueEventPreloader::OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources)
+{
+	if (!World || !World->IsGameWorld() || Requests.IsEmpty())
+	{
+		return;
+	}
+
+	// Other game worlds (PIE clients, a dedicated server in the same process) may still post the events.
+	if (GEngine)
+	{
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			const UWorld* OtherWorld = WorldContext.World();
+			if (OtherWorld && (OtherWorld != World) && OtherWorld->IsGameWorld())
+			{
+				return;
+			}
+		}
+	}
+
+	// The next map prefetches its own events on load, notifies that post before that load them on first use.
+	ReleaseAllRequests();
+}
+
+void FAkGameplayCueEventPreloader::OnPostLoadMapWithWorld(UWorld* World)
+{
+	if (!World || !World->IsGameWorld() || !UAkGameplayCueSettings::Get()->bPrefetchOnMapLoad)
+	{
+		return;
+	}
+
+	UGameplayCueManager* CueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
+	UGameplayCueSet* RuntimeCueSet = CueManager ? CueManager->GetRuntimeCueSet() : nullptr;
+	if (!RuntimeCueSet)
+	{
+		return;
+	}
+
+	// Covers notify classes that were loaded before this map, e.g. in the editor where PostLoad doesn't prefetch.
+	for (const FGameplayCueNotifyData& CueData : RuntimeCueSet->GameplayCueData)
+	{
+		PrefetchNotifyClass(CueData.LoadedGameplayCueClass);
+	}
+}
+
+bool FAkGameplayCueEventPreloader::TickQueuedPosts(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	const double MaxQueuedPostDelay = UAkGameplayCueSettings::Get()->MaxQueuedPostDelay;
+
+	QueuedPosts.RemoveAll([this, Now, MaxQueuedPostDelay](const FQueuedPost& QueuedPost)
+	{
+		UWorld* World = QueuedPost.World.Get();
+		AActor* TargetActor = QueuedPost.TargetActor.Get();
+		if (!World || (QueuedPost.bAttachToTarget && !TargetActor))
+		{
+			return true;
+		}
+
+		UAkAudioEvent* Event = GetReadyEvent(QueuedPost.Event);
+		if (!Event)
+		{
+			if ((Now - QueuedPost.QueueTime) > MaxQueuedPostDelay)
+			{
+				UE_LOG(LogAkGameplayCueNotify, Verbose, TEXT("AkGameplayCueNotify: Dropped queued post of [%s], it wasn't ready in time."), *QueuedPost.Event.ToString());
+				AkGameplayCueStats::RecordRejectedPost();
+				return true;
+			}
+
+			return false;
+		}
+
+		// Nothing would ever stop a late looping post, the notify that posted it doesn't know its playing ID.
+		if (Event->IsInfinite)
+		{
+			UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCueNotify: Dropped queued post of infinite Ak event [%s], use another load policy for looping events."), *Event->GetPathName());
+			return true;
+		}
+
+		if (FAkGameplayCueNotify_AkEventInfo::PostToSoundEngine(Event, World, TargetActor, QueuedPost.SpawnTransform, QueuedPost.bAttachToTarget) != AK_INVALID_PLAYING_ID)
+		{
+			AkGameplayCueStats::RecordPost();
+		}
+
+		return true;
+	});
+
+	if (QueuedPosts.IsEmpty())
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+
+	return true;
+}
+
+void FAkGameplayCueEventPreloader::OnEventPrepared(AkUInt32 BankID, const void* InMemoryBankPtr, AKRESULT LoadResult, void* Cookie)
+{
+	if (LoadResult != AK_Success)
+	{
+		UE_LOG(LogAkGameplayCueNotify, Verbose, TEXT("AkGameplayCueNotify: Preparing Ak event %u failed (%d), its media will be loaded on post."), BankID, static_cast<int32>(LoadResult));
+	}
+
+	FRequest* Request = static_cast<FRequest*>(Cookie);
+	Request->bPrepareSucceeded = (LoadResult == AK_Success);
+	Request->bPrepared = true;
+}
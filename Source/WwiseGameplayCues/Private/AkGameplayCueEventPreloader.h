@@ -0,0 +1,92 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Engine/StreamableManager.h"
+
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+#include <atomic>
+
+class AActor;
+class IWwiseSoundEngineAPI;
+class UAkAudioEvent;
+class UWorld;
+
+/**
+ * FAkGameplayCueEventPreloader
+ *
+ *	Asynchronously loads the Ak events referenced by gameplay cue notifies and prepares their media in the background,
+ *	so the first post of an event doesn't hitch.  Also holds the posts that were queued while their event wasn't ready.
+ *	Requests are released (and their events unprepared) once the last game world is cleaned up, so events only stay resident for the maps that use them.
+ *	Game thread only, except for the prepare callbacks.
+ */
+class FAkGameplayCueEventPreloader
+{
+public:
+	static FAkGameplayCueEventPreloader& Get();
+
+	/** Hooks map loads and world cleanup.  Called on module startup. */
+	void Initialize();
+
+	/** Drops all requests and queued posts.  Called on module shutdown. */
+	void Shutdown();
+
+	/** Starts loading and preparing the event, if not done already. */
+	void Prefetch(const TSoftObjectPtr<UAkAudioEvent>& Event);
+
+	/** Prefetches the Ak events of a notify class, if it is one of ours. */
+	void PrefetchNotifyClass(const UClass* NotifyClass);
+
+	/** Returns the event if it is loaded, otherwise null.  Kicks off the prefetch if not done already. */
+	UAkAudioEvent* GetReadyEvent(const TSoftObjectPtr<UAkAudioEvent>& Event);
+
+	/** Posts the event once it is ready.  Queued posts don't return a playing ID and are dropped if the event isn't ready in time. */
+	void QueuePost(const TSoftObjectPtr<UAkAudioEvent>& Event, UWorld* World, AActor* TargetActor, const FTransform& SpawnTransform, bool bAttachToTarget);
+
+	/** Logs the state of all requests. */
+	void Dump() const;
+
+private:
+	struct FRequest
+	{
+		TSharedPtr<FStreamableHandle> LoadHandle;
+		AkUniqueID PreparedEventID = AK_INVALID_UNIQUE_ID;
+
+		/** Set from the sound engine callback once the prepare finished (successfully or not). */
+		std::atomic<bool> bPrepared = false;
+		std::atomic<bool> bPrepareSucceeded = false;
+	};
+
+	struct FQueuedPost
+	{
+		TSoftObjectPtr<UAkAudioEvent> Event;
+		TWeakObjectPtr<UWorld> World;
+		TWeakObjectPtr<AActor> TargetActor;
+		FTransform SpawnTransform;
+		double QueueTime;
+		bool bAttachToTarget;
+	};
+
+	FRequest& FindOrAddRequest(const TSoftObjectPtr<UAkAudioEvent>& Event);
+	void OnEventLoaded(FRequest* Request, FSoftObjectPath EventPath);
+	void ReleaseRequest(FRequest& Request, IWwiseSoundEngineAPI* SoundEngine);
+	void ReleaseAllRequests();
+	void OnPostLoadMapWithWorld(UWorld* World);
+	void OnWorldCleanup(UWorld* World, bool bSessionEnded, bool bCleanupResources);
+	bool TickQueuedPosts(float DeltaTime);
+
+	static void OnEventPrepared(AkUInt32 BankID, const void* InMemoryBankPtr, AKRESULT LoadResult, void* Cookie);
+
+	/** Requests never move, the prepare callbacks hold on to them through their cookie. */
+	TMap<FSoftObjectPath, TUniquePtr<FRequest>> Requests;
+
+	TArray<FQueuedPost> QueuedPosts;
+
+	FStreamableManager StreamableManager;
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle PostLoadMapHandle;
+	FDelegateHandle WorldCleanupHandle;
+};
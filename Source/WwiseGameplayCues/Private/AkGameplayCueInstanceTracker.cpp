@@ -0,0 +1,157 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueInstanceTracker.h"
+
+#include "AkAudioEvent.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueTypes.h"
+#include "Algo/Count.h"
+#include "GameFramework/Actor.h"
+
+template <typename PredicateType>
+bool FAkGameplayCueInstanceTracker::StopOldestInstance(TArray<FInstance>& Instances, PredicateType Predicate)
+{
+	const int32 Index = Instances.IndexOfByPredicate(Predicate);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const AkPlayingID PlayingID = Instances[Index].PlayingID;
+	PlayingIdToEvent.Remove(PlayingID);
+	Instances.RemoveAt(Index, 1, EAllowShrinking::No);
+
+	// Stolen like any other stop, so the ID leaves the live ID registry and goes through the stop queue.  Its slot is freed already.
+	FAkGameplayCueLiveIDRegistry::Get().Stop(PlayingID, 0, AkCurveInterpolation_Linear);
+
+	return true;
+}
+
+bool FAkGameplayCueInstanceTracker::AcquireSlot(
+	const FAkGameplayCueNotify_ConcurrencyInfo& Concurrency,
+	const UAkAudioEvent* Event,
+	const AActor* Target,
+	const AActor* Instigator)
+{
+	check(IsInGameThread());
+
+	TArray<FInstance>* Instances = EventInstances.Find(Event);
+	if (!Instances)
+	{
+		return true;
+	}
+
+	PruneInstances(*Instances, FPlatformTime::Seconds());
+
+	const bool bCanSteal = (Concurrency.Policy == EAkGameplayCueConcurrencyPolicy::StopOldest);
+
+	// Makes room in a single scope.  Returns false if the new instance has to be rejected.
+	auto MakeRoomInScope = [this, Instances, bCanSteal](int32 MaxInstances, auto Predicate)
+	{
+		if (MaxInstances <= 0)
+		{
+			return true;
+		}
+
+		for (int32 Count = Algo::CountIf(*Instances, Predicate); Count >= MaxInstances; --Count)
+		{
+			if (!bCanSteal || !StopOldestInstance(*Instances, Predicate))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	};
+
+	const TObjectKey<AActor> TargetKey(Target);
+	const TObjectKey<AActor> InstigatorKey(Instigator);
+
+	bool bCanPost = MakeRoomInScope(Concurrency.MaxInstancesPerEvent, [](const FInstance&) { return true; });
+	bCanPost = bCanPost && MakeRoomInScope(Concurrency.MaxInstancesPerTarget, [TargetKey](const FInstance& Instance) { return Instance.TargetKey == TargetKey; });
+	bCanPost = bCanPost && (!Instigator || MakeRoomInScope(Concurrency.MaxInstancesPerInstigator, [InstigatorKey](const FInstance& Instance) { return Instance.InstigatorKey == InstigatorKey; }));
+
+	if (Instances->IsEmpty())
+	{
+		EventInstances.Remove(Event);
+	}
+
+	return bCanPost;
+}
+
+void FAkGameplayCueInstanceTracker::TrackInstance(
+	AkPlayingID PlayingID,
+	const UAkAudioEvent* Event,
+	const AActor* Target,
+	const AActor* Instigator,
+	bool bStopsWithTarget)
+{
+	check(IsInGameThread());
+
+	if ((PlayingID == AK_INVALID_PLAYING_ID) || !Event)
+	{
+		return;
+	}
+
+	// Finite events finish on their own, so there is no need to wait for an end of event callback to free the slot.
+	// Events without duration data would free their slot right away and never be limited, they hold it for a conservative lifetime instead.
+	double Lifetime = TNumericLimits<double>::Max();
+	if (!Event->IsInfinite)
+	{
+		const float Duration = FMath::Max(Event->MinimumDuration, Event->MaximumDuration);
+		Lifetime = (Duration > 0.f) ? Duration : UAkGameplayCueSettings::Get()->UnknownDurationInstanceLifetime;
+	}
+
+	FInstance& Instance = EventInstances.FindOrAdd(Event).AddDefaulted_GetRef();
+	Instance.PlayingID = PlayingID;
+	Instance.Target = Target;
+	Instance.TargetKey = Target;
+	Instance.InstigatorKey = Instigator;
+	Instance.ExpireTime = FPlatformTime::Seconds() + Lifetime;
+	Instance.bStopsWithTarget = bStopsWithTarget;
+
+	PlayingIdToEvent.Add(PlayingID, Event);
+}
+
+void FAkGameplayCueInstanceTracker::ReleaseInstance(AkPlayingID PlayingID)
+{
+	check(IsInGameThread());
+
+	TObjectKey<UAkAudioEvent> EventKey;
+	if (!PlayingIdToEvent.RemoveAndCopyValue(PlayingID, EventKey))
+	{
+		return;
+	}
+
+	if (TArray<FInstance>* Instances = EventInstances.Find(EventKey))
+	{
+		Instances->RemoveAll([PlayingID](const FInstance& Instance) { return Instance.PlayingID == PlayingID; });
+		if (Instances->IsEmpty())
+		{
+			EventInstances.Remove(EventKey);
+		}
+	}
+}
+
+void FAkGameplayCueInstanceTracker::Reset()
+{
+	EventInstances.Empty();
+	PlayingIdToEvent.Empty();
+}
+
+void FAkGameplayCueInstanceTracker::PruneInstances(TArray<FInstance>& Instances, double Now)
+{
+	Instances.RemoveAll([this, Now](const FInstance& Instance)
+	{
+		// Attached instances are stopped by the integration when their target goes away.
+		const bool bFinished = (Now >= Instance.ExpireTime) || (Instance.bStopsWithTarget && !Instance.Target.IsValid());
+		if (bFinished)
+		{
+			PlayingIdToEvent.Remove(Instance.PlayingID);
+		}
+
+		return bFinished;
+	});
+}
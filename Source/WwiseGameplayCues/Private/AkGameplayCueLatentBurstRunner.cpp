@@ -0,0 +1,67 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueLatentBurstRunner.h"
+
+#include "AkGameplayCueNotify_BurstSequence.h"
+#include "GameFramework/Actor.h"
+
+void FAkGameplayCueLatentBurstRunner::Start(const UAkGameplayCueNotify_BurstSequence* Notify, AActor* Target, const FGameplayCueParameters& Parameters, double Now)
+{
+	check(IsInGameThread());
+
+	TUniquePtr<FLatentBurst> LatentBurst = FreeBursts.IsEmpty() ? MakeUnique<FLatentBurst>() : FreeBursts.Pop(EAllowShrinking::No);
+	LatentBurst->Notify = Notify;
+	LatentBurst->Target = Target;
+	LatentBurst->Parameters = Parameters;
+	LatentBurst->StartTime = Now;
+	LatentBurst->NextFollowUpIndex = 0;
+	LatentBurst->bHasTarget = (Target != nullptr);
+	LatentBurst->bFinished = false;
+
+	RunningBursts.Add(MoveTemp(LatentBurst));
+}
+
+void FAkGameplayCueLatentBurstRunner::Tick(double Now)
+{
+	// New sequences started by follow-ups are appended and picked up by this loop as well.
+	for (int32 Index = 0; Index < RunningBursts.Num(); ++Index)
+	{
+		FLatentBurst& LatentBurst = *RunningBursts[Index];
+
+		const UAkGameplayCueNotify_BurstSequence* Notify = LatentBurst.Notify.Get();
+		AActor* Target = LatentBurst.Target.Get();
+		if (!Notify || (LatentBurst.bHasTarget && !IsValid(Target)))
+		{
+			LatentBurst.bFinished = true;
+			continue;
+		}
+
+		const TArray<FAkGameplayCueNotify_FollowUpBurst>& FollowUpBursts = Notify->GetFollowUpBursts();
+		const double Elapsed = Now - LatentBurst.StartTime;
+
+		while (FollowUpBursts.IsValidIndex(LatentBurst.NextFollowUpIndex) && (Elapsed >= FollowUpBursts[LatentBurst.NextFollowUpIndex].Delay))
+		{
+			Notify->ExecuteFollowUp(LatentBurst.NextFollowUpIndex++, Target, LatentBurst.Parameters);
+		}
+
+		LatentBurst.bFinished = !FollowUpBursts.IsValidIndex(LatentBurst.NextFollowUpIndex);
+	}
+
+	for (int32 Index = RunningBursts.Num() - 1; Index >= 0; --Index)
+	{
+		if (RunningBursts[Index]->bFinished)
+		{
+			// Drop the references held by the parameters (e.g. the effect context) right away.
+			RunningBursts[Index]->Parameters = FGameplayCueParameters();
+			FreeBursts.Add(MoveTemp(RunningBursts[Index]));
+			RunningBursts.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+}
+
+void FAkGameplayCueLatentBurstRunner::Reset()
+{
+	RunningBursts.Empty();
+	FreeBursts.Empty();
+}
@@ -0,0 +1,261 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueLiveIDRegistry.h"
+
+#include "AkAudioEvent.h"
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueLoopAggregator.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueStopQueue.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTypes.h"
+#include "Engine/World.h"
+#include "GameplayCueNotify_Actor.h"
+
+static FAutoConsoleCommand DumpLiveIDsCommand(
+	TEXT("AkGameplayCue.DumpLiveIDs"),
+	TEXT("Logs the live infinite Ak gameplay cue events per owning notify class, and the orphans found so far."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FAkGameplayCueLiveIDRegistry::Get().Dump();
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs PurgeLiveIDsCommand(
+	TEXT("AkGameplayCue.PurgeLiveIDs"),
+	TEXT("Stops all live infinite Ak gameplay cue events of the current world.  With Orphans, only stops the ones whose owner or target is gone.  With All, stops them in all worlds."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		FAkGameplayCueLiveIDRegistry& Registry = FAkGameplayCueLiveIDRegistry::Get();
+		if (Args.Contains(TEXT("Orphans")))
+		{
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Live IDs: %d orphans stopped."), Registry.Sweep());
+		}
+		else
+		{
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Live IDs: %d stopped."), Registry.Purge(Args.Contains(TEXT("All")) ? nullptr : World));
+		}
+	}));
+
+FAkGameplayCueLiveIDRegistry& FAkGameplayCueLiveIDRegistry::Get()
+{
+	static FAkGameplayCueLiveIDRegistry Instance;
+	return Instance;
+}
+
+void FAkGameplayCueLiveIDRegistry::Initialize()
+{
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FAkGameplayCueLiveIDRegistry::Tick));
+	WorldTearDownHandle = FWorldDelegates::OnWorldBeginTearDown.AddRaw(this, &FAkGameplayCueLiveIDRegistry::OnWorldBeginTearDown);
+}
+
+void FAkGameplayCueLiveIDRegistry::Shutdown()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FWorldDelegates::OnWorldBeginTearDown.Remove(WorldTearDownHandle);
+	TickerHandle.Reset();
+	WorldTearDownHandle.Reset();
+
+	LiveIDs.Empty();
+}
+
+FAkGameplayCueLiveIDRegistry::FScopedOwner::FScopedOwner(const UObject* Owner)
+	: PreviousOwner(FAkGameplayCueLiveIDRegistry::Get().CurrentOwner)
+{
+	check(IsInGameThread());
+	FAkGameplayCueLiveIDRegistry::Get().CurrentOwner = Owner;
+}
+
+FAkGameplayCueLiveIDRegistry::FScopedOwner::~FScopedOwner()
+{
+	FAkGameplayCueLiveIDRegistry::Get().CurrentOwner = PreviousOwner;
+}
+
+void FAkGameplayCueLiveIDRegistry::Register(const UWorld* World, AkPlayingID PlayingID, const UAkAudioEvent* Event, const AActor* Target)
+{
+	if ((PlayingID == AK_INVALID_PLAYING_ID) || !IsInGameThread())
+	{
+		return;
+	}
+
+	// Coalesced posts share an ID, the newest owner keeps it alive.
+	FLiveID& LiveID = LiveIDs.FindOrAdd(PlayingID);
+	LiveID.World = World;
+	LiveID.Owner = CurrentOwner;
+	LiveID.Target = Target;
+	LiveID.Event = Event;
+	LiveID.OwnerClassName = CurrentOwner ? CurrentOwner->GetClass()->GetFName() : NAME_None;
+	LiveID.bHasOwner = (CurrentOwner != nullptr);
+	LiveID.bHasTarget = (Target != nullptr);
+}
+
+void FAkGameplayCueLiveIDRegistry::Stop(AkPlayingID PlayingID, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation)
+{
+	check(IsInGameThread());
+
+	if (PlayingID == AK_INVALID_PLAYING_ID)
+	{
+		return;
+	}
+
+	FLiveID LiveID;
+	const bool bWasLive = LiveIDs.RemoveAndCopyValue(PlayingID, LiveID);
+
+	if (FAkGameplayCueLoopAggregator::IsInstanceID(PlayingID))
+	{
+		FAkGameplayCueLoopAggregator::Get().RemoveInstance(PlayingID, FadeDurationMs, FadeInterpolation);
+	}
+	else if (FAkGameplayCueAsyncPoster::IsHandle(PlayingID))
+	{
+		FAkGameplayCueAsyncPoster::Get().Stop(PlayingID, FadeDurationMs, FadeInterpolation);
+	}
+	else
+	{
+		FAkGameplayCueStopQueue::Get().Stop(PlayingID, FadeDurationMs, FadeInterpolation);
+
+		// Only infinite events are registered, and only their slots are still held when they are stopped.
+		if (UAkGameplayCueSubsystem* CueSubsystem = bWasLive ? UAkGameplayCueSubsystem::Get(LiveID.World.ResolveObjectPtr()) : nullptr)
+		{
+			CueSubsystem->GetInstanceTracker().ReleaseInstance(PlayingID);
+		}
+	}
+}
+
+void FAkGameplayCueLiveIDRegistry::StopWorld(const UWorld* World)
+{
+	check(IsInGameThread());
+
+	const TObjectKey<UWorld> WorldKey(World);
+	for (auto It = LiveIDs.CreateIterator(); It; ++It)
+	{
+		if (It.Value().World != WorldKey)
+		{
+			continue;
+		}
+
+		// Aggregated instances and async posts play on the world's shared and pooled emitters, which stop with the world's subsystem.
+		// The world's concurrency slots go away with its subsystem too.
+		const AkPlayingID PlayingID = It.Key();
+		if (!FAkGameplayCueLoopAggregator::IsInstanceID(PlayingID) && !FAkGameplayCueAsyncPoster::IsHandle(PlayingID))
+		{
+			FAkGameplayCueStopQueue::Get().StopWithWorld(PlayingID);
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+int32 FAkGameplayCueLiveIDRegistry::Sweep()
+{
+	check(IsInGameThread());
+
+	StoppedIDs.Reset();
+	for (const TPair<AkPlayingID, FLiveID>& Pair : LiveIDs)
+	{
+		if (IsOrphaned(Pair.Value))
+		{
+			const UAkAudioEvent* Event = Pair.Value.Event.Get();
+			UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCueNotify: Stopping orphaned playing ID %u of event [%s], its owner [%s] or target went away without stopping it."),
+				Pair.Key, Event ? *Event->GetName() : TEXT("None"), *Pair.Value.OwnerClassName.ToString());
+
+			StoppedIDs.Add(Pair.Key);
+		}
+	}
+
+	for (const AkPlayingID PlayingID : StoppedIDs)
+	{
+		Stop(PlayingID, 0, AkCurveInterpolation_Linear);
+	}
+
+	NumOrphans += StoppedIDs.Num();
+	AkGameplayCueStats::RecordOrphanedIDs(StoppedIDs.Num());
+
+	return StoppedIDs.Num();
+}
+
+int32 FAkGameplayCueLiveIDRegistry::Purge(const UWorld* World)
+{
+	check(IsInGameThread());
+
+	const TObjectKey<UWorld> WorldKey(World);
+
+	StoppedIDs.Reset();
+	for (const TPair<AkPlayingID, FLiveID>& Pair : LiveIDs)
+	{
+		if (!World || (Pair.Value.World == WorldKey))
+		{
+			StoppedIDs.Add(Pair.Key);
+		}
+	}
+
+	for (const AkPlayingID PlayingID : StoppedIDs)
+	{
+		Stop(PlayingID, 0, AkCurveInterpolation_Linear);
+	}
+
+	return StoppedIDs.Num();
+}
+
+void FAkGameplayCueLiveIDRegistry::Dump() const
+{
+	TMap<FName, int32> NumPerOwnerClass;
+	for (const TPair<AkPlayingID, FLiveID>& Pair : LiveIDs)
+	{
+		++NumPerOwnerClass.FindOrAdd(Pair.Value.OwnerClassName);
+	}
+
+	NumPerOwnerClass.ValueSort(TGreater<int32>());
+
+	UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Live IDs: %d live, %llu orphans stopped so far."), LiveIDs.Num(), NumOrphans);
+	for (const TPair<FName, int32>& Pair : NumPerOwnerClass)
+	{
+		UE_LOG(LogAkGameplayCueNotify, Display, TEXT("  %s: %d"), *Pair.Key.ToString(), Pair.Value);
+	}
+}
+
+bool FAkGameplayCueLiveIDRegistry::IsOrphaned(const FLiveID& LiveID) const
+{
+	if (LiveID.bHasTarget && !LiveID.Target.IsValid())
+	{
+		return true;
+	}
+
+	if (!LiveID.bHasOwner)
+	{
+		return false;
+	}
+
+	const UObject* Owner = LiveID.Owner.Get();
+	if (!IsValid(Owner))
+	{
+		return true;
+	}
+
+	// Recycled notify actors are back in the cue manager's pool, whatever they still play is theirs no more.
+	const AGameplayCueNotify_Actor* NotifyActor = Cast<AGameplayCueNotify_Actor>(Owner);
+	return NotifyActor && NotifyActor->bInRecycleQueue;
+}
+
+void FAkGameplayCueLiveIDRegistry::OnWorldBeginTearDown(UWorld* World)
+{
+	StopWorld(World);
+}
+
+bool FAkGameplayCueLiveIDRegistry::Tick(float DeltaTime)
+{
+	const float SweepInterval = UAkGameplayCueSettings::Get()->OrphanSweepInterval;
+	if ((SweepInterval <= 0.f) || LiveIDs.IsEmpty())
+	{
+		return true;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	if (Now >= NextSweepTime)
+	{
+		NextSweepTime = Now + SweepInterval;
+		Sweep();
+	}
+
+	return true;
+}
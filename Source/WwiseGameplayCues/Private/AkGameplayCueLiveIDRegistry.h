@@ -0,0 +1,94 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+class AActor;
+class UAkAudioEvent;
+class UWorld;
+
+/**
+ * FAkGameplayCueLiveIDRegistry
+ *
+ *	Keeps every playing ID of an infinite Ak event posted by the plugin, along with the notify that posted it and its target, until it is stopped.
+ *	Finite events end on their own and are never registered.  A periodic sweep stops the IDs whose notify was recycled or destroyed, or whose
+ *	target went away, without stopping them first.  Those voices would otherwise play until their world is torn down, which stops all of its IDs in one go.
+ *	IDs may be real playing IDs, loop aggregator instance IDs or async post handles.
+ *	Game thread only.
+ */
+class FAkGameplayCueLiveIDRegistry
+{
+public:
+	static FAkGameplayCueLiveIDRegistry& Get();
+
+	/** Starts the sweep and hooks world teardown.  Called on module startup. */
+	void Initialize();
+
+	/** Forgets all IDs.  Called on module shutdown. */
+	void Shutdown();
+
+	/** While alive, infinite events posted on the game thread are registered as owned by the notify. */
+	struct FScopedOwner
+	{
+		explicit FScopedOwner(const UObject* Owner);
+		~FScopedOwner();
+
+		UE_NONCOPYABLE(FScopedOwner);
+
+	private:
+		const UObject* PreviousOwner;
+	};
+
+	/** Registers an ID of an infinite event, owned by the notify of the innermost FScopedOwner. */
+	void Register(const UWorld* World, AkPlayingID PlayingID, const UAkAudioEvent* Event, const AActor* Target);
+
+	/** Stops an ID the plugin posted, whatever kind it is, and forgets it.  Safe to call for unregistered IDs. */
+	void Stop(AkPlayingID PlayingID, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation);
+
+	/** Stops all IDs of the world without a fade.  Called when the world begins tearing down. */
+	void StopWorld(const UWorld* World);
+
+	/** Stops the IDs whose owner or target is gone.  Returns the number of orphans found. */
+	int32 Sweep();
+
+	/** Stops all IDs of the world, or of all worlds. */
+	int32 Purge(const UWorld* World);
+
+	/** Logs the live IDs per owner class, and the orphans found so far. */
+	void Dump() const;
+
+private:
+	struct FLiveID
+	{
+		TObjectKey<UWorld> World;
+		TWeakObjectPtr<const UObject> Owner;
+		TWeakObjectPtr<const AActor> Target;
+		TWeakObjectPtr<const UAkAudioEvent> Event;
+		FName OwnerClassName;
+		bool bHasOwner;
+		bool bHasTarget;
+	};
+
+	bool IsOrphaned(const FLiveID& LiveID) const;
+	void OnWorldBeginTearDown(UWorld* World);
+	bool Tick(float DeltaTime);
+
+	TMap<AkPlayingID, FLiveID> LiveIDs;
+
+	/** Owner of the posts made right now, set by FScopedOwner. */
+	const UObject* CurrentOwner = nullptr;
+
+	uint64 NumOrphans = 0;
+	double NextSweepTime = 0.0;
+
+	/** Scratch buffer of Sweep and Purge. */
+	TArray<AkPlayingID> StoppedIDs;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+	FDelegateHandle WorldTearDownHandle;
+};
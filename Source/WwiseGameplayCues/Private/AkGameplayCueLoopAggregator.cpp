@@ -0,0 +1,270 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueLoopAggregator.h"
+
+#include "AkAudioDevice.h"
+#include "AkAudioEvent.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueTypes.h"
+#include "AkRtpc.h"
+#include "Components/SceneComponent.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+namespace AkGameplayCueLoopAggregator
+{
+	/** The sound engine counts playing IDs up from 1, it only gets here after hundreds of millions of posts. */
+	constexpr AkPlayingID FirstInstanceID = 0xF0000000u;
+
+	/** Right above the emitter pool's range. */
+	constexpr AkGameObjectID FirstGameObjectID = 0xAD00000000000000ull;
+}
+
+static FAutoConsoleCommand DumpLoopAggregatesCommand(
+	TEXT("AkGameplayCue.DumpLoopAggregates"),
+	TEXT("Logs how many aggregated looping Ak event instances play on how many shared voices."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		int32 NumInstances = 0;
+		int32 NumVoices = 0;
+		FAkGameplayCueLoopAggregator::Get().GetCounts(NumInstances, NumVoices);
+		UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Loop aggregator: %d instances on %d voices."), NumInstances, NumVoices);
+	}));
+
+FAkGameplayCueLoopAggregator& FAkGameplayCueLoopAggregator::Get()
+{
+	static FAkGameplayCueLoopAggregator Aggregator;
+	return Aggregator;
+}
+
+bool FAkGameplayCueLoopAggregator::IsInstanceID(AkPlayingID PlayingID)
+{
+	return PlayingID >= AkGameplayCueLoopAggregator::FirstInstanceID;
+}
+
+AkPlayingID FAkGameplayCueLoopAggregator::AddInstance(
+	UWorld* World,
+	const UAkAudioEvent* Event,
+	const UAkRtpc* InstanceCountRtpc,
+	const FTransform& SpawnTransform,
+	const USceneComponent* AttachComponent)
+{
+	check(IsInGameThread());
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!World || !Event || !SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return AK_INVALID_PLAYING_ID;
+	}
+
+	const FAggregateKey AggregateKey(World, Event);
+	FAggregate& Aggregate = Aggregates.FindOrAdd(AggregateKey);
+
+	const bool bFirstInstance = Aggregate.Instances.IsEmpty();
+	if (bFirstInstance)
+	{
+		Aggregate.GameObjectID = AkGameplayCueLoopAggregator::FirstGameObjectID + NextEmitterIndex++;
+		if (SoundEngine->RegisterGameObj(Aggregate.GameObjectID, "AkGameplayCueLoopAggregate") != AK_Success)
+		{
+			Aggregates.Remove(AggregateKey);
+			return AK_INVALID_PLAYING_ID;
+		}
+
+		Aggregate.InstanceCountRtpcID = InstanceCountRtpc ? InstanceCountRtpc->GetShortID() : AK_INVALID_RTPC_ID;
+	}
+
+	if (NextInstanceID < AkGameplayCueLoopAggregator::FirstInstanceID)
+	{
+		NextInstanceID = AkGameplayCueLoopAggregator::FirstInstanceID;
+	}
+
+	FInstance& Instance = Aggregate.Instances.AddDefaulted_GetRef();
+	Instance.InstanceID = NextInstanceID++;
+	Instance.AttachComponent = AttachComponent;
+	Instance.Transform = AttachComponent ? SpawnTransform.GetRelativeTransform(AttachComponent->GetComponentTransform()) : SpawnTransform;
+	Aggregate.bDirty = true;
+
+	if (bFirstInstance)
+	{
+		// The emitter needs its positions before the post, so the voice doesn't start at the origin.
+		SetPositions(Aggregate);
+		Aggregate.bDirty = false;
+
+		Aggregate.PlayingID = SoundEngine->PostEvent(Event->GetShortID(), Aggregate.GameObjectID);
+		if (Aggregate.PlayingID == AK_INVALID_PLAYING_ID)
+		{
+			SoundEngine->UnregisterGameObj(Aggregate.GameObjectID);
+			Aggregates.Remove(AggregateKey);
+			return AK_INVALID_PLAYING_ID;
+		}
+
+		AkGameplayCueStats::RecordPost();
+	}
+
+	InstanceToAggregate.Add(Instance.InstanceID, AggregateKey);
+
+	return Instance.InstanceID;
+}
+
+void FAkGameplayCueLoopAggregator::RemoveInstance(AkPlayingID InstanceID, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation)
+{
+	check(IsInGameThread());
+
+	FAggregateKey AggregateKey;
+	if (!InstanceToAggregate.RemoveAndCopyValue(InstanceID, AggregateKey))
+	{
+		return;
+	}
+
+	FAggregate* Aggregate = Aggregates.Find(AggregateKey);
+	if (!Aggregate)
+	{
+		return;
+	}
+
+	Aggregate->Instances.RemoveAllSwap([InstanceID](const FInstance& Instance)
+	{
+		return Instance.InstanceID == InstanceID;
+	}, EAllowShrinking::No);
+
+	Aggregate->bDirty = true;
+
+	if (!Aggregate->Instances.IsEmpty())
+	{
+		return;
+	}
+
+	// The last instance is gone, fade the shared voice out and unregister its emitter once the fade finished.
+	if (FAkAudioDevice* AkAudioDevice = FAkAudioDevice::Get())
+	{
+		AkAudioDevice->StopPlayingID(Aggregate->PlayingID, FadeDurationMs, FadeInterpolation);
+	}
+
+	RetiredEmitters.Add({ Aggregate->GameObjectID, FPlatformTime::Seconds() + (FadeDurationMs / 1000.0) });
+	Aggregates.Remove(AggregateKey);
+}
+
+void FAkGameplayCueLoopAggregator::UpdatePositions(const UWorld* World)
+{
+	const TObjectKey<UWorld> WorldKey(World);
+	for (TPair<FAggregateKey, FAggregate>& Pair : Aggregates)
+	{
+		if (Pair.Key.Key != WorldKey)
+		{
+			continue;
+		}
+
+		// Attached instances move with their component, so those are pushed every frame.
+		FAggregate& Aggregate = Pair.Value;
+		const bool bHasAttachedInstances = Aggregate.Instances.ContainsByPredicate([](const FInstance& Instance)
+		{
+			return !Instance.AttachComponent.IsExplicitlyNull();
+		});
+
+		if (Aggregate.bDirty || bHasAttachedInstances)
+		{
+			SetPositions(Aggregate);
+			Aggregate.bDirty = false;
+		}
+	}
+
+	UnregisterRetiredEmitters();
+}
+
+void FAkGameplayCueLoopAggregator::RemoveWorld(const UWorld* World)
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	const bool bSoundEngineInitialized = SoundEngine && SoundEngine->IsInitialized();
+
+	const TObjectKey<UWorld> WorldKey(World);
+	for (auto It = Aggregates.CreateIterator(); It; ++It)
+	{
+		if (It.Key().Key != WorldKey)
+		{
+			continue;
+		}
+
+		if (bSoundEngineInitialized)
+		{
+			SoundEngine->StopAll(It.Value().GameObjectID);
+			SoundEngine->UnregisterGameObj(It.Value().GameObjectID);
+		}
+
+		for (const FInstance& Instance : It.Value().Instances)
+		{
+			InstanceToAggregate.Remove(Instance.InstanceID);
+		}
+
+		It.RemoveCurrent();
+	}
+}
+
+void FAkGameplayCueLoopAggregator::GetCounts(int32& OutNumInstances, int32& OutNumVoices) const
+{
+	OutNumInstances = InstanceToAggregate.Num();
+	OutNumVoices = Aggregates.Num();
+}
+
+void FAkGameplayCueLoopAggregator::SetPositions(const FAggregate& Aggregate) const
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return;
+	}
+
+	TArray<AkSoundPosition, TInlineAllocator<32>> Positions;
+	Positions.Reserve(FMath::Min(Aggregate.Instances.Num(), static_cast<int32>(MAX_uint16)));
+
+	for (const FInstance& Instance : Aggregate.Instances)
+	{
+		FTransform Transform = Instance.Transform;
+		if (const USceneComponent* AttachComponent = Instance.AttachComponent.Get())
+		{
+			Transform = Instance.Transform * AttachComponent->GetComponentTransform();
+		}
+
+		AkSoundPosition& SoundPosition = Positions.AddDefaulted_GetRef();
+		FAkAudioDevice::FVectorsToAKWorldTransform(Transform.GetLocation(), Transform.GetUnitAxis(EAxis::X), Transform.GetUnitAxis(EAxis::Z), SoundPosition);
+
+		if (Positions.Num() == MAX_uint16)
+		{
+			break;
+		}
+	}
+
+	// MultiDirections keeps the loudness of a single source no matter how many instances there are, the instance count RTPC is there to scale it.
+	SoundEngine->SetMultiplePositions(Aggregate.GameObjectID, Positions.GetData(), static_cast<AkUInt16>(Positions.Num()), AK::SoundEngine::MultiPositionType_MultiDirections);
+
+	if (Aggregate.InstanceCountRtpcID != AK_INVALID_RTPC_ID)
+	{
+		SoundEngine->SetRTPCValue(Aggregate.InstanceCountRtpcID, static_cast<AkRtpcValue>(Aggregate.Instances.Num()), Aggregate.GameObjectID);
+	}
+}
+
+void FAkGameplayCueLoopAggregator::UnregisterRetiredEmitters()
+{
+	if (RetiredEmitters.IsEmpty())
+	{
+		return;
+	}
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	const bool bSoundEngineInitialized = SoundEngine && SoundEngine->IsInitialized();
+	const double Now = FPlatformTime::Seconds();
+
+	RetiredEmitters.RemoveAllSwap([SoundEngine, bSoundEngineInitialized, Now](const FRetiredEmitter& RetiredEmitter)
+	{
+		if (Now < RetiredEmitter.UnregisterTime)
+		{
+			return false;
+		}
+
+		if (bSoundEngineInitialized)
+		{
+			SoundEngine->UnregisterGameObj(RetiredEmitter.GameObjectID);
+		}
+
+		return true;
+	});
+}
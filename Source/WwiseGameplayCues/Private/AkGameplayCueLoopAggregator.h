@@ -0,0 +1,88 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+class UAkAudioEvent;
+class UAkRtpc;
+class USceneComponent;
+class UWorld;
+
+/**
+ * FAkGameplayCueLoopAggregator
+ *
+ *	Plays all live instances of an aggregated looping Ak event in a world as a single voice on a shared emitter.
+ *	The instance positions are handed to the sound engine as multiple positions of that emitter.
+ *	Instances are identified by IDs from the top of the playing ID range, so they can live in spawn results next to real playing IDs.
+ *	Game thread only.
+ */
+class FAkGameplayCueLoopAggregator
+{
+public:
+	static FAkGameplayCueLoopAggregator& Get();
+
+	/** Returns true if the ID was handed out by the aggregator rather than the sound engine. */
+	static bool IsInstanceID(AkPlayingID PlayingID);
+
+	/**
+	 * Adds an instance of the event, posting it on the shared emitter if it is the first one.
+	 * Attached instances follow the component, others stay at the spawn transform.
+	 * @return The instance ID, or AK_INVALID_PLAYING_ID if the event could not be posted.
+	 */
+	AkPlayingID AddInstance(UWorld* World, const UAkAudioEvent* Event, const UAkRtpc* InstanceCountRtpc, const FTransform& SpawnTransform, const USceneComponent* AttachComponent);
+
+	/** Removes an instance, stopping the shared voice with the given fade once the last instance is gone. */
+	void RemoveInstance(AkPlayingID InstanceID, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation);
+
+	/** Pushes the instance positions of the world's aggregates to the sound engine.  Called once per frame. */
+	void UpdatePositions(const UWorld* World);
+
+	/** Stops and unregisters everything of a world that is going away. */
+	void RemoveWorld(const UWorld* World);
+
+	/** Number of instances and shared voices, for diagnostics. */
+	void GetCounts(int32& OutNumInstances, int32& OutNumVoices) const;
+
+private:
+	struct FInstance
+	{
+		AkPlayingID InstanceID;
+		TWeakObjectPtr<const USceneComponent> AttachComponent;
+
+		/** Relative to the attach component if there is one, otherwise in world space. */
+		FTransform Transform;
+	};
+
+	struct FAggregate
+	{
+		AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+		AkPlayingID PlayingID = AK_INVALID_PLAYING_ID;
+		AkRtpcID InstanceCountRtpcID = AK_INVALID_RTPC_ID;
+		TArray<FInstance> Instances;
+		bool bDirty = false;
+	};
+
+	using FAggregateKey = TPair<TObjectKey<UWorld>, TObjectKey<UAkAudioEvent>>;
+
+	/** Game objects of stopped aggregates, unregistered once their fade out finished. */
+	struct FRetiredEmitter
+	{
+		AkGameObjectID GameObjectID;
+		double UnregisterTime;
+	};
+
+	void SetPositions(const FAggregate& Aggregate) const;
+	void UnregisterRetiredEmitters();
+
+	TMap<FAggregateKey, FAggregate> Aggregates;
+	TMap<AkPlayingID, FAggregateKey> InstanceToAggregate;
+	TArray<FRetiredEmitter> RetiredEmitters;
+
+	/** Bumped into the instance range on first use. */
+	AkPlayingID NextInstanceID = AK_INVALID_PLAYING_ID;
+	uint64 NextEmitterIndex = 0;
+};
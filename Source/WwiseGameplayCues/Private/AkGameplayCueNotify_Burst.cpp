@@ -3,34 +3,143 @@
 
 #include "AkGameplayCueNotify_Burst.h"
 
+#include "AkGameplayCueCapture.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueReusedSpawnResult.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTrace.h"
 #include "GameplayCueNotifyTypes.h"
 #include "Misc/DataValidation.h"
 
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueNotify_Burst)
 
+namespace AkGameplayCueNotify_Private
+{
+	/** Number of nested executions that reuse a spawn result. */
+	constexpr int32 NumReusedSpawnResults = 4;
+
+	static FAkGameplayCueNotify_SpawnResult ReusedSpawnResults[NumReusedSpawnResults];
+	static int32 ExecutionDepth = 0;
+
+	FScopedReusedSpawnResult::FScopedReusedSpawnResult()
+		: SpawnResult((ExecutionDepth < NumReusedSpawnResults) ? ReusedSpawnResults[ExecutionDepth] : FallbackSpawnResult)
+	{
+		check(IsInGameThread());
+		++ExecutionDepth;
+	}
+
+	FScopedReusedSpawnResult::~FScopedReusedSpawnResult()
+	{
+		SpawnResult.Reset();
+		--ExecutionDepth;
+	}
+}
+
 UAkGameplayCueNotify_Burst::UAkGameplayCueNotify_Burst()
+	: bSuppressPredictedDuplicates(false)
+	, DuplicateWindow(0.5f)
+	, bFireAndForget(false)
+	, DispatchPriority(EAkGameplayCueDispatchPriority::High)
+	, MaxDispatchDelay(0.2f)
+	, bOnBurstImplemented(true)
+	, bOnBurstLookedUp(false)
 {
 }
 
-bool UAkGameplayCueNotify_Burst::OnExecute_Implementation(
+void UAkGameplayCueNotify_Burst::PrefetchAkEvents() const
+{
+	BurstEffects.PrefetchAkEvents();
+}
+
+void UAkGameplayCueNotify_Burst::PostLoad()
+{
+	Super::PostLoad();
+
+	// The cue manager loads notify classes ahead of their first use, which is the earliest point to get their events ready.
+	// In the editor everything is loaded up front, there the map load prefetch covers the cues that are actually used.
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GIsEditor && !IsRunningCommandlet())
+	{
+		PrefetchAkEvents();
+		NeedsSpawnResult();
+	}
+}
+
+bool UAkGameplayCueNotify_Burst::NeedsSpawnResult() const
+{
+	if (bFireAndForget)
+	{
+		return false;
+	}
+
+	// Editors may add an OnBurst implementation between plays, so it is only looked up once outside the editor.
+	if (!bOnBurstLookedUp || GIsEditor)
+	{
+		bOnBurstImplemented = GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UAkGameplayCueNotify_Burst, OnBurst));
+		bOnBurstLookedUp = true;
+	}
+
+	return bOnBurstImplemented;
+}
+
+void UAkGameplayCueNotify_Burst::ExecuteBurst(
 	AActor* MyTarget,
 	const FGameplayCueParameters& Parameters) const
 {
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
 	UWorld* World = (IsValid(MyTarget) ? MyTarget->GetWorld() : GetWorld());
 
 	FGameplayCueNotify_SpawnContext SpawnContext(World, MyTarget, Parameters);
 	SpawnContext.SetDefaultSpawnCondition(&DefaultSpawnCondition);
 	SpawnContext.SetDefaultPlacementInfo(&DefaultPlacementInfo);
 
-	if (DefaultSpawnCondition.ShouldSpawn(SpawnContext))
+	if (!DefaultSpawnCondition.ShouldSpawn(SpawnContext))
 	{
-		FAkGameplayCueNotify_SpawnResult SpawnResult;
-		BurstEffects.ExecuteEffects(SpawnContext, SpawnResult);
+		return;
+	}
 
-		OnBurst(MyTarget, Parameters, SpawnResult);
+	// Nothing looks at the spawn result, so none is collected and there is no blueprint event to call.
+	if (!NeedsSpawnResult())
+	{
+		BurstEffects.ExecuteEffectsFireAndForget(SpawnContext);
+		AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, nullptr);
+		return;
 	}
 
+	AkGameplayCueNotify_Private::FScopedReusedSpawnResult ScopedSpawnResult;
+	BurstEffects.ExecuteEffects(SpawnContext, ScopedSpawnResult.SpawnResult);
+	AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, &ScopedSpawnResult.SpawnResult);
+
+	OnBurst(MyTarget, Parameters, ScopedSpawnResult.SpawnResult);
+}
+
+bool UAkGameplayCueNotify_Burst::OnExecute_Implementation(
+	AActor* MyTarget,
+	const FGameplayCueParameters& Parameters) const
+{
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, Parameters);
+
+	UWorld* World = (IsValid(MyTarget) ? MyTarget->GetWorld() : GetWorld());
+
+	UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World);
+	if (bSuppressPredictedDuplicates && CueSubsystem && CueSubsystem->IsDuplicateExecution(GameplayCueTag, MyTarget, Parameters, DuplicateWindow))
+	{
+		return false;
+	}
+
+	FAkGameplayCueBurstDispatcher* Dispatcher = CueSubsystem ? &CueSubsystem->GetBurstDispatcher() : nullptr;
+
+	if (Dispatcher && Dispatcher->ShouldDefer(DispatchPriority))
+	{
+		Dispatcher->Defer(this, MyTarget, Parameters, DispatchPriority, MaxDispatchDelay, World->GetTimeSeconds());
+		return false;
+	}
+
+	FAkGameplayCueBurstDispatcher::FScopedExecution ScopedExecution(Dispatcher);
+	ExecuteBurst(MyTarget, Parameters);
+
 	return false;
 }
 
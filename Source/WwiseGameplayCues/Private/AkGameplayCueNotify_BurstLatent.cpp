@@ -4,6 +4,10 @@
 #include "AkGameplayCueNotify_BurstLatent.h"
 
 #include "AkComponent.h"
+#include "AkGameplayCueCapture.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTrace.h"
 
 #if WITH_EDITOR
 #include "Misc/DataValidation.h"
@@ -22,13 +26,45 @@ AAkGameplayCueNotify_BurstLatent::AAkGameplayCueNotify_BurstLatent(const FObject
 	PrimaryActorTick.bStartWithTickEnabled = false;
 	bAutoDestroyOnRemove = true;
 	NumPreallocatedInstances = 3;
+	bRecycleWhenEffectsFinish = false;
+	bSuppressPredictedDuplicates = false;
+	DuplicateWindow = 0.5f;
 
 	Recycle();
 }
 
+void AAkGameplayCueNotify_BurstLatent::PrefetchAkEvents() const
+{
+	BurstEffects.PrefetchAkEvents();
+}
+
+void AAkGameplayCueNotify_BurstLatent::PostLoad()
+{
+	Super::PostLoad();
+
+	// Same as UAkGameplayCueNotify_Burst::PostLoad.
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GIsEditor && !IsRunningCommandlet())
+	{
+		PrefetchAkEvents();
+	}
+}
+
+void AAkGameplayCueNotify_BurstLatent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleasePreallocatorUsage();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 bool AAkGameplayCueNotify_BurstLatent::Recycle()
 {
 	Super::Recycle();
+	ReleasePreallocatorUsage();
+
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(GetWorld()))
+	{
+		CueSubsystem->StopWatchingCompletion(this);
+	}
 	BurstSpawnResults.Reset();
 	return true;
 }
@@ -37,15 +73,37 @@ bool AAkGameplayCueNotify_BurstLatent::OnExecute_Implementation(
 	AActor* MyTarget,
 	const FGameplayCueParameters& Parameters)
 {
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, Parameters);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
 	UWorld* World = GetWorld();
 
+	// The cue manager handed out this instance already, hand it back on the next tick without spawning anything.
+	// Not counted as a live instance, suppressed duplicates would inflate the preallocation profile.
+	UAkGameplayCueSubsystem* CueSubsystem = bSuppressPredictedDuplicates ? UAkGameplayCueSubsystem::Get(World) : nullptr;
+	if (CueSubsystem && CueSubsystem->IsDuplicateExecution(GameplayCueTag, MyTarget, Parameters, DuplicateWindow))
+	{
+		FinishTimerHandle = World->GetTimerManager().SetTimerForNextTick(this, &AGameplayCueNotify_Actor::GameplayCueFinishedCallback);
+		return false;
+	}
+
+	AcquirePreallocatorUsage();
+
 	FGameplayCueNotify_SpawnContext SpawnContext(World, MyTarget, Parameters);
 	SpawnContext.SetDefaultSpawnCondition(&DefaultSpawnCondition);
 	SpawnContext.SetDefaultPlacementInfo(&DefaultPlacementInfo);
 
+	UAkGameplayCueSubsystem* CompletionSubsystem = bRecycleWhenEffectsFinish ? UAkGameplayCueSubsystem::Get(World) : nullptr;
+
 	if (DefaultSpawnCondition.ShouldSpawn(SpawnContext))
 	{
-		BurstEffects.ExecuteEffects(SpawnContext, BurstSpawnResults);
+		{
+			UAkGameplayCueSubsystem::FScopedCompletionTracking CompletionTracking(CompletionSubsystem);
+			BurstEffects.ExecuteEffects(SpawnContext, BurstSpawnResults);
+		}
+
+		AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, &BurstSpawnResults);
 		OnBurst(MyTarget, Parameters, BurstSpawnResults);
 	}
 
@@ -58,9 +116,45 @@ bool AAkGameplayCueNotify_BurstLatent::OnExecute_Implementation(
 		World->GetTimerManager().SetTimer(FinishTimerHandle, this, &AGameplayCueNotify_Actor::GameplayCueFinishedCallback, Lifetime);
 	}
 
+	// Recycles as soon as the effects ended, the timer above only remains as a cap.
+	if (CompletionSubsystem)
+	{
+		CompletionSubsystem->WatchCompletion(this, BurstSpawnResults);
+	}
+
 	return false;
 }
 
+void AAkGameplayCueNotify_BurstLatent::AcquirePreallocatorUsage()
+{
+	if (bCountedByPreallocator)
+	{
+		return;
+	}
+
+	// Counted until recycled, so the next session preallocates as many instances as were alive at once.
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(GetWorld()))
+	{
+		CueSubsystem->GetPreallocator().OnInstanceAcquired(this);
+		bCountedByPreallocator = true;
+	}
+}
+
+void AAkGameplayCueNotify_BurstLatent::ReleasePreallocatorUsage()
+{
+	if (!bCountedByPreallocator)
+	{
+		return;
+	}
+
+	bCountedByPreallocator = false;
+
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(GetWorld()))
+	{
+		CueSubsystem->GetPreallocator().OnInstanceReleased(this);
+	}
+}
+
 #if WITH_EDITOR
 EDataValidationResult AAkGameplayCueNotify_BurstLatent::IsDataValid(class FDataValidationContext& Context) const
 {
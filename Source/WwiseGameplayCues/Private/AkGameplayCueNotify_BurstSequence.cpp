@@ -0,0 +1,132 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueNotify_BurstSequence.h"
+
+#include "AkGameplayCueCapture.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueReusedSpawnResult.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTrace.h"
+#include "GameplayCueNotifyTypes.h"
+#include "Misc/DataValidation.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueNotify_BurstSequence)
+
+#define LOCTEXT_NAMESPACE "AkGameplayCueNotify"
+
+FAkGameplayCueNotify_FollowUpBurst::FAkGameplayCueNotify_FollowUpBurst()
+	: Delay(0.f)
+{
+}
+
+UAkGameplayCueNotify_BurstSequence::UAkGameplayCueNotify_BurstSequence()
+{
+}
+
+void UAkGameplayCueNotify_BurstSequence::PrefetchAkEvents() const
+{
+	BurstEffects.PrefetchAkEvents();
+
+	for (const FAkGameplayCueNotify_FollowUpBurst& FollowUpBurst : FollowUpBursts)
+	{
+		FollowUpBurst.BurstEffects.PrefetchAkEvents();
+	}
+}
+
+void UAkGameplayCueNotify_BurstSequence::ExecuteFollowUp(
+	int32 FollowUpIndex,
+	AActor* Target,
+	const FGameplayCueParameters& Parameters) const
+{
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
+	if (!FollowUpBursts.IsValidIndex(FollowUpIndex))
+	{
+		return;
+	}
+
+	UWorld* World = (IsValid(Target) ? Target->GetWorld() : GetWorld());
+
+	FGameplayCueNotify_SpawnContext SpawnContext(World, Target, Parameters);
+	SpawnContext.SetDefaultSpawnCondition(&DefaultSpawnCondition);
+	SpawnContext.SetDefaultPlacementInfo(&DefaultPlacementInfo);
+
+	AkGameplayCueNotify_Private::FScopedReusedSpawnResult ScopedSpawnResult;
+	FollowUpBursts[FollowUpIndex].BurstEffects.ExecuteEffects(SpawnContext, ScopedSpawnResult.SpawnResult);
+	AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, Target, &ScopedSpawnResult.SpawnResult);
+
+	OnFollowUpBurst(Target, Parameters, FollowUpIndex, ScopedSpawnResult.SpawnResult);
+}
+
+void UAkGameplayCueNotify_BurstSequence::PostLoad()
+{
+	Super::PostLoad();
+
+	// Same as UAkGameplayCueNotify_Burst::PostLoad.
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GIsEditor && !IsRunningCommandlet())
+	{
+		PrefetchAkEvents();
+	}
+}
+
+bool UAkGameplayCueNotify_BurstSequence::OnExecute_Implementation(
+	AActor* MyTarget,
+	const FGameplayCueParameters& Parameters) const
+{
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, Parameters);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
+	UWorld* World = (IsValid(MyTarget) ? MyTarget->GetWorld() : GetWorld());
+
+	FGameplayCueNotify_SpawnContext SpawnContext(World, MyTarget, Parameters);
+	SpawnContext.SetDefaultSpawnCondition(&DefaultSpawnCondition);
+	SpawnContext.SetDefaultPlacementInfo(&DefaultPlacementInfo);
+
+	if (DefaultSpawnCondition.ShouldSpawn(SpawnContext))
+	{
+		{
+			AkGameplayCueNotify_Private::FScopedReusedSpawnResult ScopedSpawnResult;
+			BurstEffects.ExecuteEffects(SpawnContext, ScopedSpawnResult.SpawnResult);
+			AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, &ScopedSpawnResult.SpawnResult);
+
+			OnBurst(MyTarget, Parameters, ScopedSpawnResult.SpawnResult);
+		}
+
+		UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World);
+		if (CueSubsystem && !FollowUpBursts.IsEmpty())
+		{
+			CueSubsystem->GetLatentBurstRunner().Start(this, MyTarget, Parameters, World->GetTimeSeconds());
+		}
+	}
+
+	return false;
+}
+
+#if WITH_EDITOR
+EDataValidationResult UAkGameplayCueNotify_BurstSequence::IsDataValid(class FDataValidationContext& Context) const
+{
+	BurstEffects.ValidateAssociatedAssets(this, TEXT("BurstEffects"), Context);
+
+	for (int32 FollowUpIndex = 0; FollowUpIndex < FollowUpBursts.Num(); ++FollowUpIndex)
+	{
+		const FAkGameplayCueNotify_FollowUpBurst& FollowUpBurst = FollowUpBursts[FollowUpIndex];
+		FollowUpBurst.BurstEffects.ValidateAssociatedAssets(this, FString::Printf(TEXT("FollowUpBursts[%d].BurstEffects"), FollowUpIndex), Context);
+
+		if ((FollowUpIndex > 0) && (FollowUpBurst.Delay < FollowUpBursts[FollowUpIndex - 1].Delay))
+		{
+			Context.AddWarning(FText::Format(
+				LOCTEXT("AkFollowUpBurst_OutOfOrder", "Follow-up burst [{0}] of asset [{1}] has a shorter delay than the one before it, it will only spawn after that one."),
+				FText::AsNumber(FollowUpIndex),
+				FText::AsCultureInvariant(GetPathName())));
+		}
+	}
+
+	return ((Context.GetNumErrors() > 0) ? EDataValidationResult::Invalid : EDataValidationResult::Valid);
+}
+#endif
+
+#undef LOCTEXT_NAMESPACE
@@ -3,6 +3,15 @@
 
 #include "AkGameplayCueNotify_Looping.h"
 
+#include "AkGameplayCueCapture.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTrace.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueNotify_Looping)
 
@@ -15,12 +24,32 @@ AAkGameplayCueNotify_Looping::AAkGameplayCueNotify_Looping(const FObjectInitiali
 	bAutoDestroyOnRemove = true;
 	bAllowMultipleWhileActiveEvents = false;
 	NumPreallocatedInstances = 3;
+	bRecycleWhenRemovalEffectsFinish = false;
 
 	DefaultPlacementInfo.AttachPolicy = EGameplayCueNotify_AttachPolicy::AttachToTarget;
 
 	Recycle();
 }
 
+void AAkGameplayCueNotify_Looping::PrefetchAkEvents() const
+{
+	ApplicationEffects.PrefetchAkEvents();
+	LoopingEffects.PrefetchAkEvents();
+	RecurringEffects.PrefetchAkEvents();
+	RemovalEffects.PrefetchAkEvents();
+}
+
+void AAkGameplayCueNotify_Looping::PostLoad()
+{
+	Super::PostLoad();
+
+	// Same as UAkGameplayCueNotify_Burst::PostLoad.
+	if (HasAnyFlags(RF_ClassDefaultObject) && !GIsEditor && !IsRunningCommandlet())
+	{
+		PrefetchAkEvents();
+	}
+}
+
 bool AAkGameplayCueNotify_Looping::Recycle()
 {
 	Super::Recycle();
@@ -35,6 +64,16 @@ bool AAkGameplayCueNotify_Looping::Recycle()
 
 	bLoopingEffectsRemoved = true;
 
+	ReleasePreallocatorUsage();
+
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(GetWorld()))
+	{
+		CueSubsystem->StopWatchingCompletion(this);
+	}
+
+	LoopingTarget.Reset();
+	LoopingParameters = FGameplayCueParameters();
+
 	return true;
 }
 
@@ -42,6 +81,12 @@ bool AAkGameplayCueNotify_Looping::OnActive_Implementation(
 	AActor* MyTarget,
 	const FGameplayCueParameters& Parameters)
 {
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::OnActive, this, GameplayCueTag, MyTarget, Parameters);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
+	AcquirePreallocatorUsage();
+
 	UWorld* World = GetWorld();
 
 	FGameplayCueNotify_SpawnContext SpawnContext(World, MyTarget, Parameters);
@@ -51,6 +96,7 @@ bool AAkGameplayCueNotify_Looping::OnActive_Implementation(
 	if (DefaultSpawnCondition.ShouldSpawn(SpawnContext))
 	{
 		ApplicationEffects.ExecuteEffects(SpawnContext, ApplicationSpawnResults);
+		AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::OnActive, this, GameplayCueTag, MyTarget, &ApplicationSpawnResults);
 
 		OnApplication(MyTarget, Parameters, ApplicationSpawnResults);
 	}
@@ -62,6 +108,13 @@ bool AAkGameplayCueNotify_Looping::WhileActive_Implementation(
 	AActor* MyTarget,
 	const FGameplayCueParameters& Parameters)
 {
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::WhileActive, this, GameplayCueTag, MyTarget, Parameters);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
+	// OnActive is skipped for cues that were already active when they became relevant.
+	AcquirePreallocatorUsage();
+
 	UWorld* World = GetWorld();
 
 	FGameplayCueNotify_SpawnContext SpawnContext(World, MyTarget, Parameters);
@@ -72,6 +125,16 @@ bool AAkGameplayCueNotify_Looping::WhileActive_Implementation(
 	{
 		bLoopingEffectsRemoved = false;
 		LoopingEffects.StartEffects(SpawnContext, LoopingSpawnResults);
+		AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::WhileActive, this, GameplayCueTag, MyTarget, &LoopingSpawnResults);
+
+		// Loops outlive the moment they started, so out of range events get to start once a listener comes close.
+		UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World);
+		if (CueSubsystem && LoopingSpawnResults.HasCulledAkEvents())
+		{
+			LoopingTarget = MyTarget;
+			LoopingParameters = Parameters;
+			CueSubsystem->AddCulledLoop(this);
+		}
 
 		OnLoopingStart(MyTarget, Parameters, LoopingSpawnResults);
 	}
@@ -83,6 +146,10 @@ bool AAkGameplayCueNotify_Looping::OnExecute_Implementation(
 	AActor* MyTarget,
 	const FGameplayCueParameters& Parameters)
 {
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, Parameters);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
 	UWorld* World = GetWorld();
 
 	FGameplayCueNotify_SpawnContext SpawnContext(World, MyTarget, Parameters);
@@ -92,6 +159,7 @@ bool AAkGameplayCueNotify_Looping::OnExecute_Implementation(
 	if (DefaultSpawnCondition.ShouldSpawn(SpawnContext))
 	{
 		RecurringEffects.ExecuteEffects(SpawnContext, RecurringSpawnResults);
+		AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Executed, this, GameplayCueTag, MyTarget, &RecurringSpawnResults);
 
 		OnRecurring(MyTarget, Parameters, RecurringSpawnResults);
 	}
@@ -103,8 +171,16 @@ bool AAkGameplayCueNotify_Looping::OnRemove_Implementation(
 	AActor* MyTarget,
 	const FGameplayCueParameters& Parameters)
 {
+	SCOPE_CYCLE_UOBJECT(Notify, this);
+	AK_GAMEPLAY_CUE_CAPTURE_EVENT(EGameplayCueEvent::Removed, this, GameplayCueTag, MyTarget, Parameters);
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+
 	RemoveLoopingEffects();
 
+	// Only worth it if there is a delay to cut short, otherwise the notify finishes right after this anyway.
+	const bool bWatchCompletion = bRecycleWhenRemovalEffectsFinish && bAutoDestroyOnRemove && (AutoDestroyDelay > 0.f);
+	UAkGameplayCueSubsystem* CompletionSubsystem = bWatchCompletion ? UAkGameplayCueSubsystem::Get(GetWorld()) : nullptr;
+
 	// Don't spawn removal effects if our target is gone
 	if (IsValid(MyTarget))
 	{
@@ -116,13 +192,21 @@ bool AAkGameplayCueNotify_Looping::OnRemove_Implementation(
 
 		if (DefaultSpawnCondition.ShouldSpawn(SpawnContext))
 		{
+			UAkGameplayCueSubsystem::FScopedCompletionTracking CompletionTracking(CompletionSubsystem);
 			RemovalEffects.ExecuteEffects(SpawnContext, RemovalSpawnResults);
+			AK_GAMEPLAY_CUE_TRACE_EVENT(EGameplayCueEvent::Removed, this, GameplayCueTag, MyTarget, &RemovalSpawnResults);
 		}
 	}
 
 	// Always call OnRemoval(), even if target is bad, so it can clean up BP-spawned things.
 	OnRemoval(MyTarget, Parameters, RemovalSpawnResults);
 
+	// The auto destroy timer started after this remains as a cap.
+	if (CompletionSubsystem)
+	{
+		CompletionSubsystem->WatchCompletion(this, RemovalSpawnResults);
+	}
+
 	return false;
 }
 
@@ -133,22 +217,69 @@ void AAkGameplayCueNotify_Looping::EndPlay(const EEndPlayReason::Type EndPlayRea
 		RemoveLoopingEffects();
 	}
 
+	ReleasePreallocatorUsage();
+
 	Super::EndPlay(EndPlayReason);
 }
 
+void AAkGameplayCueNotify_Looping::AcquirePreallocatorUsage()
+{
+	if (bCountedByPreallocator)
+	{
+		return;
+	}
+
+	// Counted until recycled, so the next session preallocates as many instances as were alive at once.
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(GetWorld()))
+	{
+		CueSubsystem->GetPreallocator().OnInstanceAcquired(this);
+		bCountedByPreallocator = true;
+	}
+}
+
+void AAkGameplayCueNotify_Looping::ReleasePreallocatorUsage()
+{
+	if (!bCountedByPreallocator)
+	{
+		return;
+	}
+
+	bCountedByPreallocator = false;
+
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(GetWorld()))
+	{
+		CueSubsystem->GetPreallocator().OnInstanceReleased(this);
+	}
+}
+
 #if WITH_EDITOR
 EDataValidationResult AAkGameplayCueNotify_Looping::IsDataValid(class FDataValidationContext& Context) const
 {
-	TArray<FText> ValidationErrors;
 	ApplicationEffects.ValidateAssociatedAssets(this, TEXT("ApplicationEffects"), Context);
 	LoopingEffects.ValidateAssociatedAssets(this, TEXT("LoopingEffects"), Context);
 	RecurringEffects.ValidateAssociatedAssets(this, TEXT("RecurringEffects"), Context);
 	RemovalEffects.ValidateAssociatedAssets(this, TEXT("RemovalEffects"), Context);
 
-	return ((ValidationErrors.Num() > 0) ? EDataValidationResult::Invalid : EDataValidationResult::Valid);
+	return ((Context.GetNumErrors() > 0) ? EDataValidationResult::Invalid : EDataValidationResult::Valid);
 }
 #endif
 
+bool AAkGameplayCueNotify_Looping::StartCulledLoopingEffects()
+{
+	AActor* Target = LoopingTarget.Get();
+	if (bLoopingEffectsRemoved || !IsValid(Target) || !LoopingSpawnResults.HasCulledAkEvents())
+	{
+		return false;
+	}
+
+	FGameplayCueNotify_SpawnContext SpawnContext(GetWorld(), Target, LoopingParameters);
+	SpawnContext.SetDefaultSpawnCondition(&DefaultSpawnCondition);
+	SpawnContext.SetDefaultPlacementInfo(&DefaultPlacementInfo);
+
+	const FAkGameplayCueLiveIDRegistry::FScopedOwner ScopedOwner(this);
+	return LoopingEffects.StartCulledEffects(SpawnContext, LoopingSpawnResults);
+}
+
 void AAkGameplayCueNotify_Looping::RemoveLoopingEffects()
 {
 	if (bLoopingEffectsRemoved)
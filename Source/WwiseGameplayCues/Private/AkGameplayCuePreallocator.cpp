@@ -0,0 +1,226 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCuePreallocator.h"
+
+#include "AbilitySystemGlobals.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueTypes.h"
+#include "Dom/JsonObject.h"
+#include "Engine/World.h"
+#include "GameplayCueManager.h"
+#include "GameplayCueNotify_Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace AkGameplayCuePreallocator
+{
+	constexpr int32 ProfileVersion = 1;
+
+	/** Preallocated instances only reach the pool through recycling, there is no point without it. */
+	bool IsActorRecyclingEnabled()
+	{
+		static const IConsoleVariable* RecycleCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("AbilitySystem.GameplayCueActorRecycle"));
+		return !RecycleCVar || (RecycleCVar->GetInt() > 0);
+	}
+}
+
+void FAkGameplayCuePreallocator::Initialize(UWorld& World)
+{
+	const UAkGameplayCueSettings* Settings = UAkGameplayCueSettings::Get();
+	bEnabled = Settings->bAdaptivePreallocation && AkGameplayCuePreallocator::IsActorRecyclingEnabled();
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	FString ProfileString;
+	if (!FFileHelper::LoadFileToString(ProfileString, *GetProfileFilename(World)))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Profile;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ProfileString), Profile) || !Profile.IsValid()
+		|| (Profile->GetIntegerField(TEXT("Version")) != AkGameplayCuePreallocator::ProfileVersion))
+	{
+		UE_LOG(LogAkGameplayCueNotify, Log, TEXT("AkGameplayCueNotify: Ignoring outdated or invalid preallocation profile [%s]."), *GetProfileFilename(World));
+		return;
+	}
+
+	const TSharedPtr<FJsonObject>* Peaks = nullptr;
+	if (!Profile->TryGetObjectField(TEXT("Peaks"), Peaks))
+	{
+		return;
+	}
+
+	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Peaks)->Values)
+	{
+		const int32 Peak = FMath::Min(static_cast<int32>(Pair.Value->AsNumber()), Settings->MaxPreallocatedInstancesPerClass);
+		if (Peak > 0)
+		{
+			const FSoftClassPath ClassPath(Pair.Key);
+			ProfiledPeaks.Add(ClassPath, Peak);
+			PendingPreallocations.Add({ ClassPath, Peak });
+		}
+	}
+}
+
+void FAkGameplayCuePreallocator::Deinitialize(UWorld& World)
+{
+	if (bEnabled && !ClassUsage.IsEmpty())
+	{
+		// Peaks that weren't reached this session decay slowly, so a short session doesn't wipe the profile.
+		TMap<FSoftClassPath, int32> Peaks;
+		for (const TPair<FSoftClassPath, int32>& Pair : ProfiledPeaks)
+		{
+			Peaks.Add(Pair.Key, Pair.Value - 1);
+		}
+
+		for (const TPair<TObjectKey<UClass>, FClassUsage>& Pair : ClassUsage)
+		{
+			int32& Peak = Peaks.FindOrAdd(Pair.Value.ClassPath);
+			Peak = FMath::Max(Peak, Pair.Value.PeakLive);
+		}
+
+		TSharedRef<FJsonObject> PeaksJson = MakeShared<FJsonObject>();
+		for (const TPair<FSoftClassPath, int32>& Pair : Peaks)
+		{
+			if (Pair.Value > 0)
+			{
+				PeaksJson->SetNumberField(Pair.Key.ToString(), Pair.Value);
+			}
+		}
+
+		TSharedRef<FJsonObject> Profile = MakeShared<FJsonObject>();
+		Profile->SetNumberField(TEXT("Version"), AkGameplayCuePreallocator::ProfileVersion);
+		Profile->SetObjectField(TEXT("Peaks"), PeaksJson);
+
+		FString ProfileString;
+		const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ProfileString);
+		if (!FJsonSerializer::Serialize(Profile, Writer) || !FFileHelper::SaveStringToFile(ProfileString, *GetProfileFilename(World)))
+		{
+			UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCueNotify: Failed to save preallocation profile [%s]."), *GetProfileFilename(World));
+		}
+	}
+
+	bEnabled = false;
+	ProfiledPeaks.Empty();
+	ClassUsage.Empty();
+	PendingPreallocations.Empty();
+}
+
+void FAkGameplayCuePreallocator::Tick(UWorld& World)
+{
+	if (PendingPreallocations.IsEmpty())
+	{
+		return;
+	}
+
+	UGameplayCueManager* CueManager = UAbilitySystemGlobals::Get().GetGameplayCueManager();
+	if (!CueManager)
+	{
+		return;
+	}
+
+	const double EndTime = FPlatformTime::Seconds() + (UAkGameplayCueSettings::Get()->PreallocationBudgetMs / 1000.0);
+
+	for (int32 Index = PendingPreallocations.Num() - 1; Index >= 0; --Index)
+	{
+		FPendingPreallocation& Pending = PendingPreallocations[Index];
+
+		// Cue classes are loaded by the cue manager, not by us.  Classes that aren't loaded yet are retried next frame.
+		UClass* NotifyClass = Pending.ClassPath.ResolveClass();
+		if (!NotifyClass)
+		{
+			continue;
+		}
+
+		if (!NotifyClass->IsChildOf<AGameplayCueNotify_Actor>())
+		{
+			PendingPreallocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		// The cue manager preallocates the class default itself, only the instances beyond that are ours to add.
+		const int32 NumPreallocatedByManager = NotifyClass->GetDefaultObject<AGameplayCueNotify_Actor>()->NumPreallocatedInstances;
+		Pending.NumRemaining = FMath::Min(Pending.NumRemaining, ProfiledPeaks.FindRef(Pending.ClassPath) - NumPreallocatedByManager);
+
+		while ((Pending.NumRemaining > 0) && (FPlatformTime::Seconds() < EndTime))
+		{
+			FActorSpawnParameters SpawnParams;
+			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+			SpawnParams.ObjectFlags |= RF_Transient;
+
+			// Finishing a fresh instance recycles it into the cue manager's pool, the same way a played out instance is.
+			if (AGameplayCueNotify_Actor* Instance = World.SpawnActor<AGameplayCueNotify_Actor>(NotifyClass, FTransform::Identity, SpawnParams))
+			{
+				CueManager->NotifyGameplayCueActorFinished(Instance);
+			}
+
+			--Pending.NumRemaining;
+		}
+
+		if (Pending.NumRemaining <= 0)
+		{
+			PendingPreallocations.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+
+		if (FPlatformTime::Seconds() >= EndTime)
+		{
+			break;
+		}
+	}
+}
+
+void FAkGameplayCuePreallocator::OnInstanceAcquired(const AGameplayCueNotify_Actor* Instance)
+{
+	if (!bEnabled)
+	{
+		return;
+	}
+
+	const UClass* NotifyClass = Instance->GetClass();
+	FClassUsage* Usage = ClassUsage.Find(NotifyClass);
+	if (!Usage)
+	{
+		Usage = &ClassUsage.Add(NotifyClass);
+		Usage->ClassPath = FSoftClassPath(NotifyClass);
+	}
+
+	++Usage->NumLive;
+	Usage->PeakLive = FMath::Max(Usage->PeakLive, Usage->NumLive);
+}
+
+void FAkGameplayCuePreallocator::OnInstanceReleased(const AGameplayCueNotify_Actor* Instance)
+{
+	if (FClassUsage* Usage = ClassUsage.Find(Instance->GetClass()))
+	{
+		Usage->NumLive = FMath::Max(Usage->NumLive - 1, 0);
+	}
+}
+
+void FAkGameplayCuePreallocator::Dump() const
+{
+	for (const TPair<TObjectKey<UClass>, FClassUsage>& Pair : ClassUsage)
+	{
+		const UClass* NotifyClass = Pair.Key.ResolveObjectPtr();
+		const int32 NumPreallocatedByManager = NotifyClass ? NotifyClass->GetDefaultObject<AGameplayCueNotify_Actor>()->NumPreallocatedInstances : 0;
+
+		UE_LOG(LogAkGameplayCueNotify, Display, TEXT("  %s: %d live, peak %d (profiled %d, class default preallocates %d)."),
+			*Pair.Value.ClassPath.ToString(), Pair.Value.NumLive, Pair.Value.PeakLive, ProfiledPeaks.FindRef(Pair.Value.ClassPath), NumPreallocatedByManager);
+	}
+
+	UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Preallocator: %d classes profiled, %d pending preallocations."), ProfiledPeaks.Num(), PendingPreallocations.Num());
+}
+
+FString FAkGameplayCuePreallocator::GetProfileFilename(const UWorld& World)
+{
+	const FString MapName = FPackageName::GetShortName(UWorld::RemovePIEPrefix(World.GetOutermost()->GetName()));
+	return FPaths::ProjectSavedDir() / TEXT("AkGameplayCues") / TEXT("Preallocation") / (MapName + TEXT(".json"));
+}
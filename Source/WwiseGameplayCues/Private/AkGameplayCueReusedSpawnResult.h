@@ -0,0 +1,26 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueTypes.h"
+
+namespace AkGameplayCueNotify_Private
+{
+	/**
+	 * Hands out a spawn result kept alive between executions of non-instanced notifies, so their buffers are reused and
+	 * steady state bursts don't allocate.  One is kept per execution depth (OnBurst may execute other cues), deeper
+	 * nesting falls back to a local one.  They are reset after every execution, so they never keep anything referenced.
+	 * Game thread only.
+	 */
+	struct FScopedReusedSpawnResult
+	{
+		FScopedReusedSpawnResult();
+		~FScopedReusedSpawnResult();
+
+		FAkGameplayCueNotify_SpawnResult& SpawnResult;
+
+	private:
+		FAkGameplayCueNotify_SpawnResult FallbackSpawnResult;
+	};
+}
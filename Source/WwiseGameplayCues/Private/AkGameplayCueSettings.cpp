@@ -0,0 +1,39 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueSettings.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueSettings)
+
+UAkGameplayCueSettings::UAkGameplayCueSettings()
+	: bUseEmitterPool(true)
+	, EmitterPoolSize(32)
+	, EmitterPoolOverflowPolicy(EAkGameplayCueEmitterPoolOverflowPolicy::Grow)
+	, MaxEmitterPoolSize(128)
+	, bCacheAttachedEmitters(true)
+	, AttachedEmitterPoolSize(16)
+	, bPrewarmAttachedEmittersForPawns(true)
+	, bCullByAttenuationRadius(true)
+	, AttenuationCullPadding(500.f)
+	, BurstParticleCullDistance(0.f)
+	, CulledLoopRetryInterval(0.25f)
+	, bPrefetchOnMapLoad(true)
+	, MaxQueuedPostDelay(0.25f)
+	, bAsyncPosting(false)
+	, BurstDispatchBudgetMs(1.f)
+	, UnknownDurationInstanceLifetime(5.f)
+	, bBatchLoopingStops(true)
+	, OrphanSweepInterval(2.f)
+	, FollowThrottleDistance(5000.f)
+	, FollowThrottledUpdateInterval(0.5f)
+	, bAdaptivePreallocation(true)
+	, PreallocationBudgetMs(1.f)
+	, MaxPreallocatedInstancesPerClass(32)
+{
+}
+
+FName UAkGameplayCueSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
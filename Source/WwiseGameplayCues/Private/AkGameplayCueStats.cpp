@@ -0,0 +1,29 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueStats.h"
+
+DEFINE_STAT(STAT_AkGameplayCue_ExecuteEffects);
+DEFINE_STAT(STAT_AkGameplayCue_StartEffects);
+DEFINE_STAT(STAT_AkGameplayCue_StopEffects);
+DEFINE_STAT(STAT_AkGameplayCue_PostEvent);
+DEFINE_STAT(STAT_AkGameplayCue_SubsystemTick);
+DEFINE_STAT(STAT_AkGameplayCue_AsyncPostWorker);
+DEFINE_STAT(STAT_AkGameplayCue_FlushStops);
+DEFINE_STAT(STAT_AkGameplayCue_UpdateEmitterPositions);
+
+DEFINE_STAT(STAT_AkGameplayCue_NumPosts);
+DEFINE_STAT(STAT_AkGameplayCue_NumCoalescedPosts);
+DEFINE_STAT(STAT_AkGameplayCue_NumRejectedPosts);
+DEFINE_STAT(STAT_AkGameplayCue_NumClusteredPosts);
+DEFINE_STAT(STAT_AkGameplayCue_NumCulledPosts);
+DEFINE_STAT(STAT_AkGameplayCue_NumBatchedStops);
+DEFINE_STAT(STAT_AkGameplayCue_NumDeferredBursts);
+DEFINE_STAT(STAT_AkGameplayCue_NumDroppedBursts);
+DEFINE_STAT(STAT_AkGameplayCue_NumSuppressedDuplicates);
+DEFINE_STAT(STAT_AkGameplayCue_NumOrphanedIDs);
+DEFINE_STAT(STAT_AkGameplayCue_NumLiveLoopingIDs);
+
+CSV_DEFINE_CATEGORY(AkGameplayCue, true);
+
+int32 AkGameplayCueStats::NumLiveLoopingIDs = 0;
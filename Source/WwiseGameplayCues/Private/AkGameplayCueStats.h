@@ -0,0 +1,123 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("AkGameplayCue"), STATGROUP_AkGameplayCue, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ExecuteEffects"), STAT_AkGameplayCue_ExecuteEffects, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StartEffects"), STAT_AkGameplayCue_StartEffects, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("StopEffects"), STAT_AkGameplayCue_StopEffects, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PostEvent"), STAT_AkGameplayCue_PostEvent, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Subsystem Tick"), STAT_AkGameplayCue_SubsystemTick, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Async Post Worker"), STAT_AkGameplayCue_AsyncPostWorker, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Flush Stops"), STAT_AkGameplayCue_FlushStops, STATGROUP_AkGameplayCue, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Update Emitter Positions"), STAT_AkGameplayCue_UpdateEmitterPositions, STATGROUP_AkGameplayCue, );
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Posted Events"), STAT_AkGameplayCue_NumPosts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Coalesced Events"), STAT_AkGameplayCue_NumCoalescedPosts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Rejected Events"), STAT_AkGameplayCue_NumRejectedPosts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Clustered Events"), STAT_AkGameplayCue_NumClusteredPosts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Culled Events"), STAT_AkGameplayCue_NumCulledPosts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Batched Stops"), STAT_AkGameplayCue_NumBatchedStops, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Deferred Bursts"), STAT_AkGameplayCue_NumDeferredBursts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Dropped Bursts"), STAT_AkGameplayCue_NumDroppedBursts, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Suppressed Duplicates"), STAT_AkGameplayCue_NumSuppressedDuplicates, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Orphaned IDs"), STAT_AkGameplayCue_NumOrphanedIDs, STATGROUP_AkGameplayCue, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Looping IDs"), STAT_AkGameplayCue_NumLiveLoopingIDs, STATGROUP_AkGameplayCue, );
+
+CSV_DECLARE_CATEGORY_EXTERN(AkGameplayCue);
+
+namespace AkGameplayCueStats
+{
+	/** Number of looping playing IDs started and not stopped yet, across all worlds. */
+	extern int32 NumLiveLoopingIDs;
+
+	/** An Ak event was posted to the sound engine. */
+	inline void RecordPost()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumPosts);
+		CSV_CUSTOM_STAT(AkGameplayCue, Posts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** An Ak event post was merged into an earlier one. */
+	inline void RecordCoalescedPost()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumCoalescedPosts);
+		CSV_CUSTOM_STAT(AkGameplayCue, CoalescedPosts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** An Ak event post was rejected before reaching the sound engine. */
+	inline void RecordRejectedPost()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumRejectedPosts);
+		CSV_CUSTOM_STAT(AkGameplayCue, RejectedPosts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** An Ak event post was merged into a nearby post of the same frame. */
+	inline void RecordClusteredPost()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumClusteredPosts);
+		CSV_CUSTOM_STAT(AkGameplayCue, ClusteredPosts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** An Ak event post was skipped because no listener was in range. */
+	inline void RecordCulledPost()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumCulledPosts);
+		CSV_CUSTOM_STAT(AkGameplayCue, CulledPosts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** A burst was deferred to a later frame because the frame's dispatch budget was spent. */
+	inline void RecordDeferredBurst()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumDeferredBursts);
+		CSV_CUSTOM_STAT(AkGameplayCue, DeferredBursts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** A deferred burst was dropped because it went stale before there was budget for it. */
+	inline void RecordDroppedBurst()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumDroppedBursts);
+		CSV_CUSTOM_STAT(AkGameplayCue, DroppedBursts, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** A burst reached a predicting client a second time and was skipped. */
+	inline void RecordSuppressedDuplicate()
+	{
+		INC_DWORD_STAT(STAT_AkGameplayCue_NumSuppressedDuplicates);
+		CSV_CUSTOM_STAT(AkGameplayCue, SuppressedDuplicates, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** Infinite events were found playing after their notify or target went away, and stopped. */
+	inline void RecordOrphanedIDs(int32 NumOrphans)
+	{
+		INC_DWORD_STAT_BY(STAT_AkGameplayCue_NumOrphanedIDs, NumOrphans);
+		CSV_CUSTOM_STAT(AkGameplayCue, OrphanedIDs, NumOrphans, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** Queued stops were sent to the sound engine at the end of the frame. */
+	inline void RecordBatchedStops(int32 NumStops)
+	{
+		INC_DWORD_STAT_BY(STAT_AkGameplayCue_NumBatchedStops, NumStops);
+		CSV_CUSTOM_STAT(AkGameplayCue, BatchedStops, NumStops, ECsvCustomStatOp::Accumulate);
+	}
+
+	/** Looping playing IDs were started (positive delta) or stopped (negative delta). */
+	inline void RecordLiveLoopingIDs(int32 Delta)
+	{
+		NumLiveLoopingIDs += Delta;
+
+		if (Delta >= 0)
+		{
+			INC_DWORD_STAT_BY(STAT_AkGameplayCue_NumLiveLoopingIDs, Delta);
+		}
+		else
+		{
+			DEC_DWORD_STAT_BY(STAT_AkGameplayCue_NumLiveLoopingIDs, -Delta);
+		}
+	}
+}
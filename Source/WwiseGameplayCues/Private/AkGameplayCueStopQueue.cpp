@@ -0,0 +1,143 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueStopQueue.h"
+
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueTypes.h"
+#include "Misc/CoreDelegates.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+static FAutoConsoleCommand DumpStopQueueCommand(
+	TEXT("AkGameplayCue.DumpStopQueue"),
+	TEXT("Logs the number of queued Ak gameplay cue event stops."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		FAkGameplayCueStopQueue::Get().Dump();
+	}));
+
+FAkGameplayCueStopQueue& FAkGameplayCueStopQueue::Get()
+{
+	static FAkGameplayCueStopQueue Instance;
+	return Instance;
+}
+
+void FAkGameplayCueStopQueue::Initialize()
+{
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FAkGameplayCueStopQueue::OnEndFrame);
+}
+
+void FAkGameplayCueStopQueue::Shutdown()
+{
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	EndFrameHandle.Reset();
+
+	Flush();
+
+	StoppedWithWorld.Empty();
+}
+
+void FAkGameplayCueStopQueue::Stop(AkPlayingID PlayingID, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation)
+{
+	check(IsInGameThread());
+
+	if (PlayingID == AK_INVALID_PLAYING_ID)
+	{
+		return;
+	}
+
+	if (StoppedWithWorld.Remove(PlayingID) > 0)
+	{
+		return;
+	}
+
+	if (!UAkGameplayCueSettings::Get()->bBatchLoopingStops)
+	{
+		if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get(); SoundEngine && SoundEngine->IsInitialized())
+		{
+			SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Stop, PlayingID, FadeDurationMs, FadeInterpolation);
+		}
+		return;
+	}
+
+	if (FQueuedStop* QueuedStop = QueuedStops.Find(PlayingID))
+	{
+		if (FadeDurationMs < QueuedStop->FadeDurationMs)
+		{
+			*QueuedStop = { FadeDurationMs, FadeInterpolation };
+		}
+		return;
+	}
+
+	QueuedStops.Add(PlayingID, { FadeDurationMs, FadeInterpolation });
+}
+
+void FAkGameplayCueStopQueue::Flush()
+{
+	check(IsInGameThread());
+
+	if (QueuedStops.IsEmpty())
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_FlushStops);
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		QueuedStops.Reset();
+		return;
+	}
+
+	SortedStops.Reset(QueuedStops.Num());
+	for (const TPair<AkPlayingID, FQueuedStop>& Pair : QueuedStops)
+	{
+		SortedStops.Emplace(Pair.Key, Pair.Value);
+	}
+	QueuedStops.Reset();
+
+	SortedStops.Sort([](const TPair<AkPlayingID, FQueuedStop>& A, const TPair<AkPlayingID, FQueuedStop>& B)
+	{
+		if (A.Value.FadeDurationMs != B.Value.FadeDurationMs)
+		{
+			return A.Value.FadeDurationMs < B.Value.FadeDurationMs;
+		}
+		return A.Value.FadeInterpolation < B.Value.FadeInterpolation;
+	});
+
+	for (const TPair<AkPlayingID, FQueuedStop>& Stop : SortedStops)
+	{
+		SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Stop, Stop.Key, Stop.Value.FadeDurationMs, Stop.Value.FadeInterpolation);
+	}
+
+	AkGameplayCueStats::RecordBatchedStops(SortedStops.Num());
+}
+
+void FAkGameplayCueStopQueue::StopWithWorld(AkPlayingID PlayingID)
+{
+	check(IsInGameThread());
+
+	if (IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get(); SoundEngine && SoundEngine->IsInitialized())
+	{
+		SoundEngine->ExecuteActionOnPlayingID(AK::SoundEngine::AkActionOnEventType_Stop, PlayingID, 0, AkCurveInterpolation_Linear);
+	}
+
+	QueuedStops.Remove(PlayingID);
+	StoppedWithWorld.Add(PlayingID);
+}
+
+void FAkGameplayCueStopQueue::Dump() const
+{
+	UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Stop queue: batching %s, %d queued stops."),
+		UAkGameplayCueSettings::Get()->bBatchLoopingStops ? TEXT("enabled") : TEXT("disabled"), QueuedStops.Num());
+}
+
+void FAkGameplayCueStopQueue::OnEndFrame()
+{
+	Flush();
+
+	// Notifies of a torn down world are removed within the frame of the teardown.
+	StoppedWithWorld.Reset();
+}
@@ -0,0 +1,58 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+/**
+ * FAkGameplayCueStopQueue
+ *
+ *	Gathers the stops of looping Ak events requested during a frame and sends them to the sound engine together at the end of the frame,
+ *	ordered by fade so stops with the same fade go out back to back, with every playing ID stopped once no matter how many notifies asked.
+ *	Game thread only.
+ */
+class FAkGameplayCueStopQueue
+{
+public:
+	static FAkGameplayCueStopQueue& Get();
+
+	/** Hooks the end of the frame.  Called on module startup. */
+	void Initialize();
+
+	/** Sends all queued stops.  Called on module shutdown. */
+	void Shutdown();
+
+	/** Queues a stop for the end of the frame, or stops right away if batching is disabled.  IDs already stopped with their world are skipped. */
+	void Stop(AkPlayingID PlayingID, AkTimeMs FadeDurationMs, AkCurveInterpolation FadeInterpolation);
+
+	/** Sends all queued stops to the sound engine. */
+	void Flush();
+
+	/** Stops right away without a fade, for IDs of a world that is torn down.  Later stops of the ID in the same frame are skipped. */
+	void StopWithWorld(AkPlayingID PlayingID);
+
+	/** Logs the number of queued stops. */
+	void Dump() const;
+
+private:
+	struct FQueuedStop
+	{
+		AkTimeMs FadeDurationMs;
+		AkCurveInterpolation FadeInterpolation;
+	};
+
+	void OnEndFrame();
+
+	/** Stops requested this frame.  A second request for the same ID keeps the shorter fade. */
+	TMap<AkPlayingID, FQueuedStop> QueuedStops;
+
+	/** IDs stopped by a world teardown this frame, the notifies removed during the teardown don't need to stop them again. */
+	TSet<AkPlayingID> StoppedWithWorld;
+
+	/** Scratch buffer of Flush. */
+	TArray<TPair<AkPlayingID, FQueuedStop>> SortedStops;
+
+	FDelegateHandle EndFrameHandle;
+};
@@ -0,0 +1,469 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "AkAudioDevice.h"
+#include "AkComponent.h"
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueLoopAggregator.h"
+#include "AkGameplayCueNotify_Looping.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueTypes.h"
+#include "Engine/World.h"
+#include "GameplayCueNotify_Actor.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueSubsystem)
+
+namespace AkGameplayCueSubsystem_Private
+{
+	/** Returns true if the execution happens inside a prediction window of this client, on the instigator's or the target's ability system. */
+	bool IsPredictedExecution(const AActor* Target, const FGameplayCueParameters& Parameters)
+	{
+		const auto IsPredicting = [](const UAbilitySystemComponent* AbilitySystem)
+		{
+			return AbilitySystem && AbilitySystem->ScopedPredictionKey.IsLocalClientKey();
+		};
+
+		const UAbilitySystemComponent* InstigatorAbilitySystem = Parameters.EffectContext.GetInstigatorAbilitySystemComponent();
+		if (!InstigatorAbilitySystem)
+		{
+			InstigatorAbilitySystem = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Parameters.Instigator.Get());
+		}
+
+		return IsPredicting(InstigatorAbilitySystem) || IsPredicting(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(Target));
+	}
+}
+
+static FAutoConsoleCommandWithWorld DumpEmitterPoolCommand(
+	TEXT("AkGameplayCue.DumpEmitterPool"),
+	TEXT("Logs the usage and hit rate of the Ak gameplay cue emitter pool and attached emitter cache of the current world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World))
+		{
+			const FAkGameplayCueEmitterPoolStats& Stats = CueSubsystem->GetEmitterPool().GetStats();
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Emitter pool: %d emitters, %d in use (peak %d), %llu requests, %.1f%% hit rate, %llu grows, %llu overflows."),
+				Stats.NumEmitters, Stats.NumInUse, Stats.PeakInUse, Stats.NumRequests, Stats.GetHitRate() * 100.f, Stats.NumGrows, Stats.NumOverflows);
+
+			const FAkGameplayCueAttachedEmitterCache& AttachedEmitterCache = CueSubsystem->GetAttachedEmitterCache();
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Attached emitters: %d cached, %d free."), AttachedEmitterCache.GetNumCached(), AttachedEmitterCache.GetNumFree());
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Followed emitters: %d."), CueSubsystem->GetEmitterUpdater().GetNumFollowed());
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld DumpPreallocationProfileCommand(
+	TEXT("AkGameplayCue.DumpPreallocationProfile"),
+	TEXT("Logs the recorded and profiled peak instance counts of the Ak gameplay cue notify actors of the current world."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World))
+		{
+			CueSubsystem->GetPreallocator().Dump();
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld DumpBurstDispatcherCommand(
+	TEXT("AkGameplayCue.DumpBurstDispatcher"),
+	TEXT("Logs how many Ak gameplay cue bursts of the current world ran right away, were deferred, were dropped and were suppressed as duplicates."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World))
+		{
+			CueSubsystem->GetBurstDispatcher().Dump();
+			UE_LOG(LogAkGameplayCueNotify, Display, TEXT("Duplicate filter: %llu suppressed."), CueSubsystem->GetDuplicateFilter().GetNumSuppressed());
+		}
+	}));
+
+UAkGameplayCueSubsystem* UAkGameplayCueSubsystem::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UAkGameplayCueSubsystem>() : nullptr;
+}
+
+AkPlayingID UAkGameplayCueSubsystem::FindCoalescedPost(const FAkGameplayCueCoalescingKey& Key) const
+{
+	const FCoalescedPost* Post = CoalescedPosts.Find(Key);
+	if (Post && IsCoalescedPostAlive(*Post))
+	{
+		return Post->PlayingID;
+	}
+
+	return AK_INVALID_PLAYING_ID;
+}
+
+void UAkGameplayCueSubsystem::AddCoalescedPost(const FAkGameplayCueCoalescingKey& Key, AkPlayingID PlayingID, float WindowSeconds)
+{
+	if (PlayingID == AK_INVALID_PLAYING_ID)
+	{
+		return;
+	}
+
+	FCoalescedPost& Post = CoalescedPosts.FindOrAdd(Key);
+	Post.PlayingID = PlayingID;
+	Post.PostFrame = GFrameCounter;
+	Post.ExpireTime = GetWorld()->GetTimeSeconds() + FMath::Max(WindowSeconds, 0.f);
+}
+
+bool UAkGameplayCueSubsystem::JoinCluster(const FAkGameplayCueClusterKey& Key, const FVector& Location, AkPlayingID& OutPlayingID)
+{
+	FCluster* Cluster = Clusters.Find(Key);
+	if (!Cluster || (Cluster->PostFrame != GFrameCounter))
+	{
+		return false;
+	}
+
+	++Cluster->NumPosts;
+	Cluster->LocationSum += Location;
+	OutPlayingID = Cluster->PlayingID;
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return true;
+	}
+
+	if (Cluster->GameObjectID != AK_INVALID_GAME_OBJECT)
+	{
+		const FVector Centroid = Cluster->LocationSum / Cluster->NumPosts;
+
+		AkSoundPosition SoundPosition;
+		FAkAudioDevice::FVectorsToAKWorldTransform(Centroid, Cluster->Transform.GetUnitAxis(EAxis::X), Cluster->Transform.GetUnitAxis(EAxis::Z), SoundPosition);
+		SoundEngine->SetPosition(Cluster->GameObjectID, SoundPosition);
+	}
+
+	// Scoped to the playing ID, pooled emitters must not carry the value over to their next post.
+	if (Cluster->ClusterSizeRtpcID != AK_INVALID_RTPC_ID)
+	{
+		SoundEngine->SetRTPCValueByPlayingID(Cluster->ClusterSizeRtpcID, static_cast<AkRtpcValue>(Cluster->NumPosts), Cluster->PlayingID);
+	}
+
+	return true;
+}
+
+void UAkGameplayCueSubsystem::AddCluster(const FAkGameplayCueClusterKey& Key, AkPlayingID PlayingID, AkGameObjectID GameObjectID, const FTransform& SpawnTransform, AkRtpcID ClusterSizeRtpcID)
+{
+	if (PlayingID == AK_INVALID_PLAYING_ID)
+	{
+		return;
+	}
+
+	FCluster& Cluster = Clusters.FindOrAdd(Key);
+	Cluster.PlayingID = PlayingID;
+	Cluster.GameObjectID = GameObjectID;
+	Cluster.ClusterSizeRtpcID = ClusterSizeRtpcID;
+	Cluster.Transform = SpawnTransform;
+	Cluster.LocationSum = SpawnTransform.GetLocation();
+	Cluster.NumPosts = 1;
+	Cluster.PostFrame = GFrameCounter;
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if ((ClusterSizeRtpcID != AK_INVALID_RTPC_ID) && SoundEngine && SoundEngine->IsInitialized())
+	{
+		SoundEngine->SetRTPCValueByPlayingID(ClusterSizeRtpcID, 1.f, PlayingID);
+	}
+}
+
+bool UAkGameplayCueSubsystem::IsCulled(const FGameplayCueNotify_SpawnContext& SpawnContext, const FVector& Location, float Range) const
+{
+	if (Range > 0.f)
+	{
+		UpdateListenerLocations();
+
+		// Without any known listener there is nothing to measure against, so nothing is culled by range.
+		if (!ListenerLocations.IsEmpty())
+		{
+			const float CullRange = Range + UAkGameplayCueSettings::Get()->AttenuationCullPadding;
+			const bool bInRange = ListenerLocations.ContainsByPredicate([&Location, CullRangeSquared = FMath::Square(CullRange)](const FVector& ListenerLocation)
+			{
+				return FVector::DistSquared(ListenerLocation, Location) <= CullRangeSquared;
+			});
+
+			if (!bInRange)
+			{
+				return true;
+			}
+		}
+	}
+
+	return IsSignificantDelegate.IsBound() && !IsSignificantDelegate.Execute(SpawnContext, Location, Range);
+}
+
+void UAkGameplayCueSubsystem::AddCulledLoop(AAkGameplayCueNotify_Looping* Notify)
+{
+	CulledLoops.AddUnique(Notify);
+}
+
+void UAkGameplayCueSubsystem::WatchCompletion(AGameplayCueNotify_Actor* Notify, const FAkGameplayCueNotify_SpawnResult& SpawnResult)
+{
+	StopWatchingCompletion(Notify);
+
+	FCompletionWatch& Watch = CompletionWatches.AddDefaulted_GetRef();
+	Watch.Notify = Notify;
+
+	for (const AkPlayingID PlayingID : SpawnResult.AkEventIDs)
+	{
+		if (PlayingID != AK_INVALID_PLAYING_ID)
+		{
+			Watch.PlayingIDs.AddUnique(PlayingID);
+		}
+	}
+
+	for (UFXSystemComponent* FxSystemComponent : SpawnResult.FxSystemComponents)
+	{
+		if (IsValid(FxSystemComponent))
+		{
+			Watch.FxSystemComponents.Add(FxSystemComponent);
+		}
+	}
+}
+
+void UAkGameplayCueSubsystem::StopWatchingCompletion(const AGameplayCueNotify_Actor* Notify)
+{
+	CompletionWatches.RemoveAllSwap([Notify](const FCompletionWatch& Watch)
+	{
+		return Watch.Notify == Notify;
+	});
+}
+
+bool UAkGameplayCueSubsystem::IsDuplicateExecution(const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters, float WindowSeconds)
+{
+	// Only clients predict, everywhere else two identical executions are two real ones.
+	const UWorld* World = GetWorld();
+	if (World->GetNetMode() != NM_Client)
+	{
+		return false;
+	}
+
+	const uint64 Key = FAkGameplayCueDuplicateFilter::MakeKey(CueTag, Target, Parameters);
+
+	// Predicted executions always run and leave a record for their replicated copy.  Observers never predict, so they never suppress.
+	if (AkGameplayCueSubsystem_Private::IsPredictedExecution(Target, Parameters))
+	{
+		DuplicateFilter.Record(Key, World->GetTimeSeconds(), WindowSeconds);
+		return false;
+	}
+
+	return DuplicateFilter.Consume(Key, World->GetTimeSeconds());
+}
+
+void UAkGameplayCueSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	EmitterPool.Initialize();
+	AttachedEmitterCache.Initialize(InWorld);
+	Preallocator.Initialize(InWorld);
+}
+
+void UAkGameplayCueSubsystem::Deinitialize()
+{
+	// Queued posts point at the completion queue and at emitters of this world.
+	FAkGameplayCueAsyncPoster::Get().Flush();
+
+	// Usually done when the world began tearing down already, worlds that skip the teardown stop their loops here.
+	FAkGameplayCueLiveIDRegistry::Get().StopWorld(GetWorld());
+
+	CoalescedPosts.Empty();
+	Clusters.Empty();
+	CulledLoops.Empty();
+	CompletionWatches.Empty();
+	CompletionQueue.CancelCallbacks();
+	EmitterUpdater.Reset();
+	InstanceTracker.Reset();
+	LatentBurstRunner.Reset();
+	BurstDispatcher.Reset();
+	DuplicateFilter.Reset();
+	Preallocator.Deinitialize(*GetWorld());
+	EmitterPool.Deinitialize();
+	AttachedEmitterCache.Deinitialize();
+	FAkGameplayCueLoopAggregator::Get().RemoveWorld(GetWorld());
+
+	Super::Deinitialize();
+}
+
+void UAkGameplayCueSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_SubsystemTick);
+
+	Super::Tick(DeltaTime);
+
+	CSV_CUSTOM_STAT(AkGameplayCue, LiveLoopingIDs, AkGameplayCueStats::NumLiveLoopingIDs, ECsvCustomStatOp::Set);
+
+	ProcessCompletionWatches();
+
+	AttachedEmitterCache.ReleaseDestroyedTargets();
+
+	RetryCulledLoops();
+
+	LatentBurstRunner.Tick(GetWorld()->GetTimeSeconds());
+
+	BurstDispatcher.Tick(GetWorld()->GetTimeSeconds());
+
+	Preallocator.Tick(*GetWorld());
+
+	FAkGameplayCueLoopAggregator::Get().UpdatePositions(GetWorld());
+
+	if (!EmitterUpdater.IsEmpty())
+	{
+		UpdateListenerLocations();
+		EmitterUpdater.Tick(GetWorld()->GetTimeSeconds(), ListenerLocations);
+	}
+
+	// Drop everything that can no longer be merged into, so the map stays as small as the current burst of posts.
+	for (auto It = CoalescedPosts.CreateIterator(); It; ++It)
+	{
+		if (!IsCoalescedPostAlive(It.Value()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Clusters only merge posts of the frame they started in.
+	for (auto It = Clusters.CreateIterator(); It; ++It)
+	{
+		if (It.Value().PostFrame != GFrameCounter)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+TStatId UAkGameplayCueSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAkGameplayCueSubsystem, STATGROUP_Tickables);
+}
+
+bool UAkGameplayCueSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return (WorldType == EWorldType::Game) || (WorldType == EWorldType::PIE);
+}
+
+bool UAkGameplayCueSubsystem::IsCoalescedPostAlive(const FCoalescedPost& Post) const
+{
+	// Posts made this frame can always be merged into, the window only extends this to later frames.
+	return (Post.PostFrame == GFrameCounter) || (GetWorld()->GetTimeSeconds() <= Post.ExpireTime);
+}
+
+void UAkGameplayCueSubsystem::UpdateListenerLocations() const
+{
+	if (ListenerLocationsFrame == GFrameCounter)
+	{
+		return;
+	}
+
+	ListenerLocationsFrame = GFrameCounter;
+	ListenerLocations.Reset();
+
+	if (FAkAudioDevice* AudioDevice = FAkAudioDevice::Get())
+	{
+		const UWorld* World = GetWorld();
+		for (const UAkComponent* Listener : AudioDevice->GetDefaultListeners())
+		{
+			if (IsValid(Listener) && (Listener->GetWorld() == World))
+			{
+				ListenerLocations.Add(Listener->GetComponentLocation());
+			}
+		}
+	}
+}
+
+void UAkGameplayCueSubsystem::ProcessCompletionWatches()
+{
+	// The pool's callbacks have to be drained either way, the finished IDs are only of interest while something waits for them.
+	const bool bWantsFinishedIDs = !CompletionWatches.IsEmpty() || InstanceTracker.HasInstances();
+
+	FinishedPlayingIDs.Reset();
+	ReleasedEmitters.Reset();
+	EmitterPool.ProcessFinishedEvents(bWantsFinishedIDs ? &FinishedPlayingIDs : nullptr, EmitterUpdater.IsEmpty() ? nullptr : &ReleasedEmitters);
+
+	// A released emitter is free to serve another post, it must not follow the old target any longer.
+	EmitterUpdater.Remove(ReleasedEmitters);
+
+	// Pooled posts report their end, which frees their concurrency slot before their duration (or the fallback lifetime) elapsed.
+	for (const AkPlayingID PlayingID : FinishedPlayingIDs)
+	{
+		InstanceTracker.ReleaseInstance(PlayingID);
+	}
+
+	FAkGameplayCueFinishedEvent FinishedEvent;
+	while (CompletionQueue.Dequeue(FinishedEvent))
+	{
+		FinishedPlayingIDs.Add(FinishedEvent.PlayingID);
+	}
+
+	if (CompletionWatches.IsEmpty())
+	{
+		return;
+	}
+
+	// Finishing recycles the notify, which removes its watch, so finish only after the walk.
+	TArray<AGameplayCueNotify_Actor*, TInlineAllocator<8>> FinishedNotifies;
+	FAkGameplayCueAsyncPoster& AsyncPoster = FAkGameplayCueAsyncPoster::Get();
+
+	for (int32 Index = CompletionWatches.Num() - 1; Index >= 0; --Index)
+	{
+		FCompletionWatch& Watch = CompletionWatches[Index];
+
+		Watch.PlayingIDs.RemoveAllSwap([this, &AsyncPoster](AkPlayingID& PlayingID)
+		{
+			// Async posts are watched by handle until the worker posted them.  Failed posts have nothing left to wait for.
+			if (FAkGameplayCueAsyncPoster::IsHandle(PlayingID))
+			{
+				AkPlayingID ResolvedPlayingID = AK_INVALID_PLAYING_ID;
+				if (!AsyncPoster.Resolve(PlayingID, ResolvedPlayingID))
+				{
+					return false;
+				}
+
+				PlayingID = ResolvedPlayingID;
+			}
+
+			return (PlayingID == AK_INVALID_PLAYING_ID) || FinishedPlayingIDs.Contains(PlayingID);
+		});
+
+		Watch.FxSystemComponents.RemoveAllSwap([](const TWeakObjectPtr<UFXSystemComponent>& FxSystemComponent)
+		{
+			return !FxSystemComponent.IsValid() || !FxSystemComponent->IsActive();
+		});
+
+		AGameplayCueNotify_Actor* Notify = Watch.Notify.Get();
+		if (!Notify || (Watch.PlayingIDs.IsEmpty() && Watch.FxSystemComponents.IsEmpty()))
+		{
+			if (Notify)
+			{
+				FinishedNotifies.Add(Notify);
+			}
+
+			CompletionWatches.RemoveAtSwap(Index, 1, EAllowShrinking::No);
+		}
+	}
+
+	for (AGameplayCueNotify_Actor* Notify : FinishedNotifies)
+	{
+		Notify->GameplayCueFinishedCallback();
+	}
+}
+
+void UAkGameplayCueSubsystem::RetryCulledLoops()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (CulledLoops.IsEmpty() || (Now < NextCulledLoopRetryTime))
+	{
+		return;
+	}
+
+	NextCulledLoopRetryTime = Now + UAkGameplayCueSettings::Get()->CulledLoopRetryInterval;
+
+	CulledLoops.RemoveAllSwap([](const TWeakObjectPtr<AAkGameplayCueNotify_Looping>& CulledLoop)
+	{
+		AAkGameplayCueNotify_Looping* Notify = CulledLoop.Get();
+		return !Notify || !Notify->StartCulledLoopingEffects();
+	});
+}
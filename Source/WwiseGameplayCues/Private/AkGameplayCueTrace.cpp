@@ -0,0 +1,59 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueTrace.h"
+
+#if AK_GAMEPLAY_CUE_TRACE_ENABLED
+
+#include "AkGameplayCueTypes.h"
+#include "GameFramework/Actor.h"
+#include "GameplayTagContainer.h"
+
+UE_TRACE_CHANNEL_DEFINE(AkGameplayCueChannel)
+
+UE_TRACE_EVENT_BEGIN(AkGameplayCue, CueEvent)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, EventType)
+	UE_TRACE_EVENT_FIELD(uint64, TargetId)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, NotifyClass)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, CueTag)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, TargetName)
+	UE_TRACE_EVENT_FIELD(uint32[], PlayingIDs)
+UE_TRACE_EVENT_END()
+
+void AkGameplayCueTrace::TraceCueEvent(
+	EGameplayCueEvent::Type EventType,
+	const UObject* Notify,
+	const FGameplayTag& CueTag,
+	const AActor* Target,
+	const FAkGameplayCueNotify_SpawnResult* SpawnResult)
+{
+	TStringBuilder<256> NotifyClassName;
+	if (Notify)
+	{
+		Notify->GetClass()->GetPathName(nullptr, NotifyClassName);
+	}
+
+	TStringBuilder<128> CueTagName;
+	CueTag.GetTagName().AppendString(CueTagName);
+
+	TStringBuilder<128> TargetName;
+	if (Target)
+	{
+		Target->GetFName().AppendString(TargetName);
+	}
+
+	const AkPlayingID* PlayingIDs = SpawnResult ? SpawnResult->AkEventIDs.GetData() : nullptr;
+	const int32 NumPlayingIDs = SpawnResult ? SpawnResult->AkEventIDs.Num() : 0;
+
+	UE_TRACE_LOG(AkGameplayCue, CueEvent, AkGameplayCueChannel)
+		<< CueEvent.Cycle(FPlatformTime::Cycles64())
+		<< CueEvent.EventType(static_cast<uint8>(EventType))
+		<< CueEvent.TargetId(static_cast<uint64>(reinterpret_cast<UPTRINT>(Target)))
+		<< CueEvent.NotifyClass(NotifyClassName.GetData(), NotifyClassName.Len())
+		<< CueEvent.CueTag(CueTagName.GetData(), CueTagName.Len())
+		<< CueEvent.TargetName(TargetName.GetData(), TargetName.Len())
+		<< CueEvent.PlayingIDs(PlayingIDs, NumPlayingIDs);
+}
+
+#endif
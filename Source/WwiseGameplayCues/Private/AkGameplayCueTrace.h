@@ -0,0 +1,39 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayCueInterface.h"
+#include "Trace/Trace.h"
+
+#define AK_GAMEPLAY_CUE_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+class AActor;
+struct FAkGameplayCueNotify_SpawnResult;
+struct FGameplayCueParameters;
+struct FGameplayTag;
+
+#if AK_GAMEPLAY_CUE_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(AkGameplayCueChannel)
+
+namespace AkGameplayCueTrace
+{
+	/**
+	 * Emits a per-cue event on the AkGameplayCue Insights channel.
+	 * Carries the notify class, cue tag, target and resulting playing IDs, so a hitch can be traced back to a cue asset.
+	 */
+	void TraceCueEvent(EGameplayCueEvent::Type EventType, const UObject* Notify, const FGameplayTag& CueTag, const AActor* Target, const FAkGameplayCueNotify_SpawnResult* SpawnResult);
+}
+
+#define AK_GAMEPLAY_CUE_TRACE_EVENT(EventType, Notify, CueTag, Target, SpawnResult) \
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(AkGameplayCueChannel)) \
+	{ \
+		AkGameplayCueTrace::TraceCueEvent(EventType, Notify, CueTag, Target, SpawnResult); \
+	}
+
+#else
+
+#define AK_GAMEPLAY_CUE_TRACE_EVENT(EventType, Notify, CueTag, Target, SpawnResult)
+
+#endif
@@ -7,9 +7,23 @@
 
 #include "AkAudioDevice.h"
 #include "AkAudioEvent.h"
+#include "AkComponent.h"
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueEventPreloader.h"
+#include "AkGameplayCueInstanceTracker.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueLoopAggregator.h"
+#include "AkGameplayCueReusedSpawnResult.h"
+#include "AkGameplayCueSettings.h"
+#include "AkGameplayCueStats.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkRtpc.h"
+#include "AkSwitchValue.h"
 #include "Camera/CameraLensEffectInterface.h"
 #include "Components/ForceFeedbackComponent.h"
 #include "Particles/ParticleSystemComponent.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
 
 #if WITH_EDITORONLY_DATA
 #include "Misc/DataValidation.h"
@@ -28,6 +42,7 @@ void FAkGameplayCueNotify_SpawnResult::Reset()
 {
 	FxSystemComponents.Reset();
 	AkEventIDs.Reset();
+	CulledAkEvents = 0;
 	CameraShakes.Reset();
 	CameraLensEffects.Reset();
 	ForceFeedbackComponent = nullptr;
@@ -51,12 +66,128 @@ void FAkGameplayCueNotify_SpawnResult::SetFromEngineSpawnResult(const FGameplayC
 	DecalComponent = SpawnResult.DecalComponent;
 }
 
+void FAkGameplayCueNotify_SpawnResult::SwapWithEngineSpawnResult(FGameplayCueNotify_SpawnResult& SpawnResult)
+{
+	Swap(FxSystemComponents, SpawnResult.FxSystemComponents);
+	Swap(CameraShakes, SpawnResult.CameraShakes);
+	Swap(CameraLensEffects, SpawnResult.CameraLensEffects);
+	Swap(ForceFeedbackComponent, SpawnResult.ForceFeedbackComponent);
+	Swap(ForceFeedbackTargetPC, SpawnResult.ForceFeedbackTargetPC);
+	Swap(DecalComponent, SpawnResult.DecalComponent);
+}
+
+namespace AkGameplayCueTypes_Private
+{
+	/**
+	 * Lends the buffers of an Ak spawn result to an engine spawn result for the duration of a scope.
+	 * The engine spawn functions then fill the Ak spawn result in place, reusing its capacity instead of allocating
+	 * a temporary result and deep-copying it afterwards.
+	 */
+	struct FScopedEngineSpawnResult
+	{
+		explicit FScopedEngineSpawnResult(FAkGameplayCueNotify_SpawnResult& InAkSpawnResult)
+			: AkSpawnResult(InAkSpawnResult)
+		{
+			AkSpawnResult.SwapWithEngineSpawnResult(EngineSpawnResult);
+		}
+
+		~FScopedEngineSpawnResult()
+		{
+			AkSpawnResult.SwapWithEngineSpawnResult(EngineSpawnResult);
+		}
+
+		FGameplayCueNotify_SpawnResult& Get()
+		{
+			return EngineSpawnResult;
+		}
+
+	private:
+		FAkGameplayCueNotify_SpawnResult& AkSpawnResult;
+		FGameplayCueNotify_SpawnResult EngineSpawnResult;
+	};
+
+	/** Returns true if an effect placed by the given placement info would go unnoticed by every local listener. */
+	bool IsEffectCulled(
+		const UAkGameplayCueSubsystem* CueSubsystem,
+		const FGameplayCueNotify_SpawnContext& SpawnContext,
+		const FGameplayCueNotify_PlacementInfo& PlacementInfo,
+		float CullRange)
+	{
+		if (!CueSubsystem || !CueSubsystem->CanCull(CullRange))
+		{
+			return false;
+		}
+
+		FTransform SpawnTransform;
+		return PlacementInfo.FindSpawnTransform(SpawnContext, SpawnTransform) && CueSubsystem->IsCulled(SpawnContext, SpawnTransform.GetLocation(), CullRange);
+	}
+}
+
+FAkGameplayCueNotify_ConcurrencyInfo::FAkGameplayCueNotify_ConcurrencyInfo()
+	: MaxInstancesPerEvent(0)
+	, MaxInstancesPerTarget(0)
+	, MaxInstancesPerInstigator(0)
+	, Policy(EAkGameplayCueConcurrencyPolicy::RejectNew)
+{
+}
+
+FAkGameplayCueNotify_RtpcBinding::FAkGameplayCueNotify_RtpcBinding()
+	: Source(EAkGameplayCueParameterSource::NormalizedMagnitude)
+	, Rtpc(nullptr)
+	, Scale(1.f)
+{
+}
+
+FAkGameplayCueNotify_SwitchBinding::FAkGameplayCueNotify_SwitchBinding()
+	: PhysicalMaterial(nullptr)
+	, SwitchValue(nullptr)
+{
+}
+
+void FAkGameplayCueBoundParameters::ApplySwitches(AkGameObjectID GameObjectID) const
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (Switches.IsEmpty() || !SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return;
+	}
+
+	for (const TPair<AkSwitchGroupID, AkSwitchStateID>& Switch : Switches)
+	{
+		SoundEngine->SetSwitch(Switch.Key, Switch.Value, GameObjectID);
+	}
+}
+
+void FAkGameplayCueBoundParameters::ApplyRtpcValues(AkPlayingID PlayingID) const
+{
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (RtpcValues.IsEmpty() || (PlayingID == AK_INVALID_PLAYING_ID) || !SoundEngine || !SoundEngine->IsInitialized())
+	{
+		return;
+	}
+
+	for (const TPair<AkRtpcID, AkRtpcValue>& RtpcValue : RtpcValues)
+	{
+		SoundEngine->SetRTPCValueByPlayingID(RtpcValue.Key, RtpcValue.Value, PlayingID);
+	}
+}
+
 FAkGameplayCueNotify_AkEventInfo::FAkGameplayCueNotify_AkEventInfo()
 	: bOverrideSpawnCondition(false)
 	, bOverridePlacementInfo(false)
 	, AkEvent(nullptr)
+	, LoadPolicy(EAkGameplayCueEventLoadPolicy::LoadSynchronous)
 	, LoopingFadeOutDurationMs(0)
 	, LoopingFadeOutInterpolation(EAkCurveInterpolation::Linear)
+	, bCoalesceDuplicatePosts(false)
+	, CoalescingWindow(0.f)
+	, bAggregateInstances(false)
+	, InstanceCountRtpc(nullptr)
+	, bClusterSameFramePosts(false)
+	, ClusterCellSize(500.f)
+	, ClusterSizeRtpc(nullptr)
+	, bFollowTarget(false)
+	, FollowUpdateInterval(0.f)
 {
 }
 
@@ -64,60 +195,473 @@ bool FAkGameplayCueNotify_AkEventInfo::PostEvent(
 	const FGameplayCueNotify_SpawnContext& SpawnContext,
 	FAkGameplayCueNotify_SpawnResult& OutSpawnResult) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_PostEvent);
+
+	AkPlayingID EventID = AK_INVALID_PLAYING_ID;
+	bool bCulled = false;
+	const bool bEventTriggered = TryPostEvent(SpawnContext, true, EventID, bCulled);
+
+	if (bCulled)
+	{
+		OutSpawnResult.MarkAkEventCulled(OutSpawnResult.AkEventIDs.Num());
+	}
+
+	// Always add to the list, even if invalid, so that the list is table and in order for blueprint users.
+	OutSpawnResult.AkEventIDs.Add(EventID);
+
+	return bEventTriggered;
+}
+
+AkPlayingID FAkGameplayCueNotify_AkEventInfo::RetryCulledPost(
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	bool& bOutCulled) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_PostEvent);
+
+	// The spawn condition already passed when the post was culled, rolling its chance again could drop the sound for good.
 	AkPlayingID EventID = AK_INVALID_PLAYING_ID;
-	bool bEventTriggered = false;
+	TryPostEvent(SpawnContext, false, EventID, bOutCulled);
 
-	if (IsValid(AkEvent))
+	return EventID;
+}
+
+bool FAkGameplayCueNotify_AkEventInfo::TryPostEvent(
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	bool bCheckSpawnCondition,
+	AkPlayingID& OutEventID,
+	bool& bOutCulled) const
+{
+	OutEventID = AK_INVALID_PLAYING_ID;
+	bOutCulled = false;
+
+	if (AkEvent.IsNull())
 	{
-		const auto& SpawnCondition = SpawnContext.GetSpawnCondition(bOverrideSpawnCondition, SpawnConditionOverride);
-		const auto& PlacementInfo = SpawnContext.GetPlacementInfo(bOverridePlacementInfo, PlacementInfoOverride);
+		return false;
+	}
+
+	const auto& SpawnCondition = SpawnContext.GetSpawnCondition(bOverrideSpawnCondition, SpawnConditionOverride);
+	const auto& PlacementInfo = SpawnContext.GetPlacementInfo(bOverridePlacementInfo, PlacementInfoOverride);
+
+	if (bCheckSpawnCondition && !SpawnCondition.ShouldSpawn(SpawnContext))
+	{
+		return false;
+	}
+
+	FTransform SpawnTransform;
+	if (!PlacementInfo.FindSpawnTransform(SpawnContext, SpawnTransform))
+	{
+		return false;
+	}
+
+	return TryPostPlacedEvent(SpawnContext, PlacementInfo, SpawnTransform, OutEventID, bOutCulled);
+}
+
+bool FAkGameplayCueNotify_AkEventInfo::TryPostPlacedEvent(
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	const FGameplayCueNotify_PlacementInfo& PlacementInfo,
+	const FTransform& SpawnTransform,
+	AkPlayingID& OutEventID,
+	bool& bOutCulled) const
+{
+	OutEventID = AK_INVALID_PLAYING_ID;
+	bOutCulled = false;
+
+	// Events that aren't loaded yet have no known radius, those are only culled by the significance hook.
+	const UAkAudioEvent* LoadedEvent = AkEvent.Get();
+	const float CullRange = (LoadedEvent && UAkGameplayCueSettings::Get()->bCullByAttenuationRadius) ? LoadedEvent->MaxAttenuationRadius : 0.f;
+
+	const UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(SpawnContext.World);
+	if (CueSubsystem && CueSubsystem->IsCulled(SpawnContext, SpawnTransform.GetLocation(), CullRange))
+	{
+		AkGameplayCueStats::RecordCulledPost();
+		bOutCulled = true;
+		return false;
+	}
+
+	const bool bAttachToTarget = SpawnContext.TargetComponent && (PlacementInfo.AttachPolicy == EGameplayCueNotify_AttachPolicy::AttachToTarget);
+
+	UAkAudioEvent* Event = ResolveAkEvent(SpawnContext, SpawnTransform, bAttachToTarget);
+	if (!Event)
+	{
+		return false;
+	}
+
+	bool bEventTriggered = true;
+	if (bAggregateInstances && Event->IsInfinite)
+	{
+		const USceneComponent* AttachComponent = (bAttachToTarget || bFollowTarget) ? SpawnContext.TargetComponent : nullptr;
+		OutEventID = FAkGameplayCueLoopAggregator::Get().AddInstance(SpawnContext.World, Event, InstanceCountRtpc, SpawnTransform, AttachComponent);
+	}
+	else
+	{
+		bEventTriggered = PostResolvedEvent(Event, SpawnContext, SpawnTransform, bAttachToTarget, OutEventID);
+	}
+
+	// Infinite events only end when stopped, the registry stops them if their notify fails to.
+	if (Event->IsInfinite)
+	{
+		FAkGameplayCueLiveIDRegistry::Get().Register(SpawnContext.World, OutEventID, Event, SpawnContext.TargetActor);
+	}
+
+	return bEventTriggered;
+}
+
+void FAkGameplayCueNotify_AkEventInfo::PrefetchAkEvent() const
+{
+	FAkGameplayCueEventPreloader::Get().Prefetch(AkEvent);
+	CompileParameterBindings();
+}
+
+void FAkGameplayCueNotify_AkEventInfo::CompileParameterBindings() const
+{
+	CompiledRtpcBindings.Reset(RtpcBindings.Num());
+	for (const FAkGameplayCueNotify_RtpcBinding& Binding : RtpcBindings)
+	{
+		if (Binding.Rtpc)
+		{
+			CompiledRtpcBindings.Add({ Binding.Rtpc->GetShortID(), Binding.Source, Binding.Scale });
+		}
+	}
+
+	CompiledSwitchBindings.Reset(SwitchBindings.Num());
+	for (const FAkGameplayCueNotify_SwitchBinding& Binding : SwitchBindings)
+	{
+		if (Binding.SwitchValue)
+		{
+			CompiledSwitchBindings.Add({ Binding.PhysicalMaterial.Get(), Binding.SourceTag, Binding.SwitchValue->GetGroupID(), Binding.SwitchValue->GetShortID() });
+		}
+	}
+
+	bParameterBindingsCompiled = true;
+
+#if WITH_EDITOR
+	ParameterBindingsEditGeneration = FAkGameplayCueCompiledBurst::CurrentEditGeneration;
+#endif
+}
+
+void FAkGameplayCueNotify_AkEventInfo::BindParameters(
+	const FGameplayCueParameters& Parameters,
+	FAkGameplayCueBoundParameters& OutBoundParameters) const
+{
+	// Edits in the editor invalidate the bindings like the compiled bursts.
+#if WITH_EDITOR
+	const bool bParameterBindingsUpToDate = bParameterBindingsCompiled && (ParameterBindingsEditGeneration == FAkGameplayCueCompiledBurst::CurrentEditGeneration);
+#else
+	const bool bParameterBindingsUpToDate = bParameterBindingsCompiled;
+#endif
+
+	if (!bParameterBindingsUpToDate)
+	{
+		CompileParameterBindings();
+	}
+
+	for (const FCompiledRtpcBinding& Binding : CompiledRtpcBindings)
+	{
+		float Value = 0.f;
+		switch (Binding.Source)
+		{
+		case EAkGameplayCueParameterSource::RawMagnitude:			Value = Parameters.RawMagnitude; break;
+		case EAkGameplayCueParameterSource::NormalizedMagnitude:	Value = Parameters.NormalizedMagnitude; break;
+		case EAkGameplayCueParameterSource::GameplayEffectLevel:	Value = static_cast<float>(Parameters.GameplayEffectLevel); break;
+		case EAkGameplayCueParameterSource::AbilityLevel:			Value = static_cast<float>(Parameters.AbilityLevel); break;
+		}
+
+		OutBoundParameters.RtpcValues.Add({ Binding.RtpcID, static_cast<AkRtpcValue>(Value * Binding.Scale) });
+	}
+
+	for (const FCompiledSwitchBinding& Binding : CompiledSwitchBindings)
+	{
+		const bool bMaterialMatches = Binding.PhysicalMaterial.IsExplicitlyNull() || (Binding.PhysicalMaterial == Parameters.PhysicalMaterial);
+		const bool bTagMatches = !Binding.SourceTag.IsValid() || Parameters.AggregatedSourceTags.HasTag(Binding.SourceTag);
+		const bool bGroupTaken = OutBoundParameters.Switches.ContainsByPredicate([GroupID = Binding.GroupID](const TPair<AkSwitchGroupID, AkSwitchStateID>& Switch)
+		{
+			return Switch.Key == GroupID;
+		});
+
+		if (bMaterialMatches && bTagMatches && !bGroupTaken)
+		{
+			OutBoundParameters.Switches.Add({ Binding.GroupID, Binding.StateID });
+		}
+	}
+}
+
+UAkAudioEvent* FAkGameplayCueNotify_AkEventInfo::ResolveAkEvent(
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	const FTransform& SpawnTransform,
+	bool bAttachToTarget) const
+{
+	FAkGameplayCueEventPreloader& Preloader = FAkGameplayCueEventPreloader::Get();
+	if (UAkAudioEvent* Event = Preloader.GetReadyEvent(AkEvent))
+	{
+		return Event;
+	}
+
+	switch (LoadPolicy)
+	{
+	case EAkGameplayCueEventLoadPolicy::Skip:
+		UE_LOG(LogAkGameplayCueNotify, Verbose, TEXT("AkGameplayCueNotify: Skipped post of Ak event [%s], it isn't ready yet."), *AkEvent.ToString());
+		AkGameplayCueStats::RecordRejectedPost();
+		return nullptr;
+
+	case EAkGameplayCueEventLoadPolicy::Queue:
+		// Queued posts bypass coalescing and concurrency, those need the playing ID at post time.
+		Preloader.QueuePost(AkEvent, SpawnContext.World, SpawnContext.TargetActor, SpawnTransform, bAttachToTarget);
+		return nullptr;
+
+	default:
+		UE_LOG(LogAkGameplayCueNotify, Warning, TEXT("AkGameplayCueNotify: Loading Ak event [%s] synchronously, it wasn't prefetched in time."), *AkEvent.ToString());
+		return AkEvent.LoadSynchronous();
+	}
+}
+
+bool FAkGameplayCueNotify_AkEventInfo::PostResolvedEvent(
+	UAkAudioEvent* Event,
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	const FTransform& SpawnTransform,
+	bool bAttachToTarget,
+	AkPlayingID& OutEventID) const
+{
+	// Nearby location posts of the same frame share one post at their centroid.
+	UAkGameplayCueSubsystem* ClusterSubsystem = (bClusterSameFramePosts && !bAttachToTarget) ? UAkGameplayCueSubsystem::Get(SpawnContext.World) : nullptr;
+	const FAkGameplayCueClusterKey ClusterKey(Event, SpawnTransform.GetLocation(), ClusterCellSize);
+
+	if (ClusterSubsystem && ClusterSubsystem->JoinCluster(ClusterKey, SpawnTransform.GetLocation(), OutEventID))
+	{
+		AkGameplayCueStats::RecordClusteredPost();
+		return true;
+	}
+
+	// Identical posts on the same target share the first playing ID instead of starting another inaudible voice.
+	UAkGameplayCueSubsystem* CueSubsystem = (bCoalesceDuplicatePosts && SpawnContext.TargetActor) ? UAkGameplayCueSubsystem::Get(SpawnContext.World) : nullptr;
+	const FAkGameplayCueCoalescingKey CoalescingKey(Event, SpawnContext.TargetActor, bAttachToTarget);
+
+	if (CueSubsystem)
+	{
+		OutEventID = CueSubsystem->FindCoalescedPost(CoalescingKey);
+	}
+
+	if (OutEventID != AK_INVALID_PLAYING_ID)
+	{
+		// Merged into an earlier post, which already counted against the concurrency limits.
+		AkGameplayCueStats::RecordCoalescedPost();
+		return true;
+	}
+
+	// Clusters and the instance tracker need the real playing ID right away.
+	const FAkGameplayCueAsyncPoster::FScopedSynchronousPosts SynchronousPosts(ClusterSubsystem || Concurrency.HasLimits());
+
+	// Rejected instances never reach the sound engine.
+	UAkGameplayCueSubsystem* TrackerSubsystem = Concurrency.HasLimits() ? UAkGameplayCueSubsystem::Get(SpawnContext.World) : nullptr;
+	FAkGameplayCueInstanceTracker* InstanceTracker = TrackerSubsystem ? &TrackerSubsystem->GetInstanceTracker() : nullptr;
+	const AActor* Instigator = SpawnContext.CueParameters.Instigator.Get();
+
+	if (InstanceTracker && !InstanceTracker->AcquireSlot(Concurrency, Event, SpawnContext.TargetActor, Instigator))
+	{
+		AkGameplayCueStats::RecordRejectedPost();
+		return false;
+	}
+
+	FAkGameplayCueBoundParameters BoundParameters;
+	BindParameters(SpawnContext.CueParameters, BoundParameters);
+
+	const FName AttachSocketName = SpawnContext.GetPlacementInfo(bOverridePlacementInfo, PlacementInfoOverride).SocketName;
+
+	AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+	OutEventID = PostToSoundEngine(Event, SpawnContext.World, SpawnContext.TargetActor, SpawnTransform, bAttachToTarget, &GameObjectID, &BoundParameters, SpawnContext.TargetComponent, AttachSocketName);
+
+	if (OutEventID != AK_INVALID_PLAYING_ID)
+	{
+		AkGameplayCueStats::RecordPost();
+	}
+
+	if (InstanceTracker)
+	{
+		InstanceTracker->TrackInstance(OutEventID, Event, SpawnContext.TargetActor, Instigator, bAttachToTarget);
+	}
+
+	// Clustered posts sit at the centroid of several targets, they can't follow any one of them.
+	if (bFollowTarget && Event->IsInfinite && !bAttachToTarget && !ClusterSubsystem && SpawnContext.TargetComponent
+		&& (OutEventID != AK_INVALID_PLAYING_ID) && (GameObjectID != AK_INVALID_GAME_OBJECT))
+	{
+		if (UAkGameplayCueSubsystem* FollowSubsystem = UAkGameplayCueSubsystem::Get(SpawnContext.World))
+		{
+			FollowSubsystem->GetEmitterUpdater().Add(GameObjectID, SpawnContext.TargetComponent, SpawnTransform, FollowUpdateInterval, SpawnContext.World->GetTimeSeconds());
+		}
+	}
+
+	if (CueSubsystem)
+	{
+		CueSubsystem->AddCoalescedPost(CoalescingKey, OutEventID, CoalescingWindow);
+	}
+
+	if (ClusterSubsystem)
+	{
+		ClusterSubsystem->AddCluster(ClusterKey, OutEventID, GameObjectID, SpawnTransform, ClusterSizeRtpc ? ClusterSizeRtpc->GetShortID() : AK_INVALID_RTPC_ID);
+	}
+
+	return true;
+}
+
+AkPlayingID FAkGameplayCueNotify_AkEventInfo::PostToSoundEngine(
+	UAkAudioEvent* Event,
+	UWorld* World,
+	AActor* TargetActor,
+	const FTransform& SpawnTransform,
+	bool bAttachToTarget,
+	AkGameObjectID* OutGameObjectID,
+	const FAkGameplayCueBoundParameters* BoundParameters,
+	USceneComponent* AttachComponent,
+	FName AttachSocketName)
+{
+	const AkPlayingID PlayingID = PostToSoundEngineWithSwitches(Event, World, TargetActor, SpawnTransform, bAttachToTarget, OutGameObjectID, BoundParameters, AttachComponent, AttachSocketName);
+
+	// Async posts apply their RTPCs on the worker, right after posting.
+	if (BoundParameters && !FAkGameplayCueAsyncPoster::IsHandle(PlayingID))
+	{
+		BoundParameters->ApplyRtpcValues(PlayingID);
+	}
+
+	return PlayingID;
+}
+
+AkPlayingID FAkGameplayCueNotify_AkEventInfo::PostToSoundEngineWithSwitches(
+	UAkAudioEvent* Event,
+	UWorld* World,
+	AActor* TargetActor,
+	const FTransform& SpawnTransform,
+	bool bAttachToTarget,
+	AkGameObjectID* OutGameObjectID,
+	const FAkGameplayCueBoundParameters* BoundParameters,
+	USceneComponent* AttachComponent,
+	FName AttachSocketName)
+{
+	if (bAttachToTarget)
+	{
+		// Cached emitters are attached once per socket and reused, so a fresh target costs no component creation here.
+		// Switches stick to the game object though, posts that set some get an emitter of their own.
+		UAkGameplayCueSubsystem* EmitterSubsystem = UAkGameplayCueSubsystem::Get(World);
+		USceneComponent* EmitterParent = AttachComponent ? AttachComponent : (TargetActor ? TargetActor->GetRootComponent() : nullptr);
+		const bool bDedicatedEmitter = BoundParameters && !BoundParameters->Switches.IsEmpty();
+
+		FAkAudioDevice* AudioDevice = FAkAudioDevice::Get();
+		IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+		const bool bSoundEngineReady = AudioDevice && SoundEngine && SoundEngine->IsInitialized();
+
+		UAkComponent* Emitter = nullptr;
+		if (bSoundEngineReady)
+		{
+			if (bDedicatedEmitter)
+			{
+				Emitter = FAkGameplayCueAttachedEmitterCache::SpawnDedicated(EmitterParent, AttachSocketName);
+			}
+			else if (EmitterSubsystem)
+			{
+				Emitter = EmitterSubsystem->GetAttachedEmitterCache().FindOrAdd(EmitterParent, AttachSocketName);
+			}
+		}
 
-		if (SpawnCondition.ShouldSpawn(SpawnContext))
+		if (Emitter)
 		{
-			FTransform SpawnTransform;
-			if (PlacementInfo.FindSpawnTransform(SpawnContext, SpawnTransform))
+			const bool bTrackCompletion = EmitterSubsystem && EmitterSubsystem->IsTrackingCompletion();
+
+			// Dedicated emitters destroy themselves through the component's event tracking, which async posts bypass.
+			FAkGameplayCueAsyncPoster& AsyncPoster = FAkGameplayCueAsyncPoster::Get();
+			if (AsyncPoster.IsEnabled() && !bDedicatedEmitter)
 			{
-				if (SpawnContext.TargetComponent && (PlacementInfo.AttachPolicy == EGameplayCueNotify_AttachPolicy::AttachToTarget))
+				FAkGameplayCueAsyncPost Post;
+				Post.EventID = Event->GetShortID();
+				Post.GameObjectID = Emitter->GetAkGameObjectID();
+
+				if (bTrackCompletion)
 				{
-					EventID = AkEvent->PostOnActor(
-						SpawnContext.TargetActor,
-						{},
-						0,
-						true);
+					Post.CallbackFlags = AK_EndOfEvent;
+					Post.Callback = &FAkGameplayCueEndOfEventQueue::OnEventCallback;
+					Post.Cookie = EmitterSubsystem->GetCompletionCookie();
 				}
-				/*else if (AkEvent->IsInfinite)
-				{
-					AkDeviceAndWorld DeviceAndWorld(SpawnContext.World);
-					if (!UNLIKELY(!DeviceAndWorld.IsValid()))
-					{
-						DeviceAndWorld.AkAudioDevice->SpawnAkComponentAtLocation(
-							AkEvent,
-							SpawnTransform.GetLocation(),
-							SpawnTransform.GetRotation().Rotator(),
-							true,
-							true,
-							DeviceAndWorld.CurrentWorld);
-					}
-				}*/
-				else
+
+				if (BoundParameters)
 				{
-					EventID = AkEvent->PostAtLocation(
-						SpawnTransform.GetLocation(),
-						SpawnTransform.GetRotation().Rotator(),
-						{},
-						0,
-						SpawnContext.World);
+					Post.BoundParameters = *BoundParameters;
 				}
 
-				bEventTriggered = true;
+				return AsyncPoster.Submit(MoveTemp(Post), Event->IsInfinite);
+			}
+
+			if (BoundParameters)
+			{
+				BoundParameters->ApplySwitches(Emitter->GetAkGameObjectID());
+			}
+
+			// Through the audio device, so the component knows about the event like about any other (active events, occlusion, end of event cleanup).
+			// The device wraps the completion cookie into its own callback package, the completion queue cancels it through the device as well.
+			const AkPlayingID PlayingID = AudioDevice->PostEventOnComponent(
+				Event->GetShortID(),
+				Emitter,
+				bTrackCompletion ? AK_EndOfEvent : 0,
+				bTrackCompletion ? &FAkGameplayCueEndOfEventQueue::OnEventCallback : nullptr,
+				bTrackCompletion ? EmitterSubsystem->GetCompletionCookie() : nullptr);
+
+			// Nothing plays on it that would end and destroy it.
+			if (bDedicatedEmitter && (PlayingID == AK_INVALID_PLAYING_ID))
+			{
+				Emitter->DestroyComponent();
 			}
+
+			return PlayingID;
 		}
+
+		// The component of the actor's root is shared by everything posted on the actor, bound switches aren't applied to it.
+
+		// Pooled emitters always report their end, attached posts only do so when someone is waiting for it.
+		UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World);
+		if (CueSubsystem && CueSubsystem->IsTrackingCompletion() && AudioDevice)
+		{
+			return AudioDevice->PostEventOnActor(
+				Event->GetShortID(),
+				TargetActor,
+				AK_EndOfEvent,
+				&FAkGameplayCueEndOfEventQueue::OnEventCallback,
+				CueSubsystem->GetCompletionCookie(),
+				true);
+		}
+
+		return Event->PostOnActor(
+			TargetActor,
+			{},
+			0,
+			true);
 	}
+	/*else if (Event->IsInfinite)
+	{
+		AkDeviceAndWorld DeviceAndWorld(World);
+		if (!UNLIKELY(!DeviceAndWorld.IsValid()))
+		{
+			DeviceAndWorld.AkAudioDevice->SpawnAkComponentAtLocation(
+				Event,
+				SpawnTransform.GetLocation(),
+				SpawnTransform.GetRotation().Rotator(),
+				true,
+				true,
+				DeviceAndWorld.CurrentWorld);
+		}
+	}*/
 
-	// Always add to the list, even if invalid, so that the list is table and in order for blueprint users.
-	OutSpawnResult.AkEventIDs.Add(EventID);
+	// Borrow a pre-registered emitter rather than registering a transient game object for this post.
+	if (UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World))
+	{
+		AkPlayingID PooledEventID = AK_INVALID_PLAYING_ID;
+		if (CueSubsystem->GetEmitterPool().PostAtLocation(Event, SpawnTransform, PooledEventID, OutGameObjectID, BoundParameters))
+		{
+			return PooledEventID;
+		}
+	}
 
-	return bEventTriggered;
+	return Event->PostAtLocation(
+		SpawnTransform.GetLocation(),
+		SpawnTransform.GetRotation().Rotator(),
+		{},
+		0,
+		World);
 }
 
 void FAkGameplayCueNotify_AkEventInfo::ValidateBurstAssets(
@@ -126,13 +670,13 @@ void FAkGameplayCueNotify_AkEventInfo::ValidateBurstAssets(
 	class FDataValidationContext& ValidationContext) const
 {
 #if WITH_EDITORONLY_DATA
-	if (AkEvent != nullptr)
+	if (const UAkAudioEvent* Event = AkEvent.LoadSynchronous())
 	{
-		if (AkEvent->IsInfinite)
+		if (Event->IsInfinite)
 		{
 			ValidationContext.AddError(FText::Format(
 				LOCTEXT("AkSoundCue_ShouldNotLoop", "Sound [{0}] used in slot [{1}] for asset [{2}] is not a one-shot, but the slot is a one-shot (the instance will be orphaned)."),
-				FText::AsCultureInvariant(AkEvent->GetPathName()),
+				FText::AsCultureInvariant(Event->GetPathName()),
 				FText::AsCultureInvariant(Context),
 				FText::AsCultureInvariant(ContainingAsset->GetPathName())));
 		}
@@ -140,6 +684,57 @@ void FAkGameplayCueNotify_AkEventInfo::ValidateBurstAssets(
 #endif
 }
 
+void FAkGameplayCueNotify_AkEventInfo::ValidateLoopingAssets(
+	const UObject* ContainingAsset,
+	const FString& Context,
+	class FDataValidationContext& ValidationContext) const
+{
+#if WITH_EDITORONLY_DATA
+	if (const UAkAudioEvent* Event = AkEvent.LoadSynchronous())
+	{
+		if (!Event->IsInfinite)
+		{
+			ValidationContext.AddError(FText::Format(
+				LOCTEXT("AkSoundCue_ShouldLoop", "Sound [{0}] used in slot [{1}] for asset [{2}] is a one-shot, but the slot is a looping slot (the sound will end while the cue is still active)."),
+				FText::AsCultureInvariant(Event->GetPathName()),
+				FText::AsCultureInvariant(Context),
+				FText::AsCultureInvariant(ContainingAsset->GetPathName())));
+		}
+	}
+	else if (!AkEvent.IsNull())
+	{
+		ValidationContext.AddError(FText::Format(
+			LOCTEXT("AkSoundCue_Missing", "Sound [{0}] used in slot [{1}] for asset [{2}] could not be loaded."),
+			FText::AsCultureInvariant(AkEvent.ToString()),
+			FText::AsCultureInvariant(Context),
+			FText::AsCultureInvariant(ContainingAsset->GetPathName())));
+	}
+
+	// Merged posts share one playing ID, the first cue to be removed would stop the loop of all the others.
+	if (bCoalesceDuplicatePosts || bClusterSameFramePosts)
+	{
+		ValidationContext.AddWarning(FText::Format(
+			LOCTEXT("AkSoundCue_LoopMerged", "Sound [{0}] used in slot [{1}] for asset [{2}] merges posts, but the slot is a looping slot (removing one cue would stop the others).  Use aggregation instead."),
+			FText::AsCultureInvariant(AkEvent.ToString()),
+			FText::AsCultureInvariant(Context),
+			FText::AsCultureInvariant(ContainingAsset->GetPathName())));
+	}
+
+	if (LoopingFadeOutDurationMs < 0)
+	{
+		ValidationContext.AddWarning(FText::Format(
+			LOCTEXT("AkSoundCue_NegativeFade", "Sound [{0}] used in slot [{1}] for asset [{2}] has a negative fade out duration, it will stop without fading."),
+			FText::AsCultureInvariant(AkEvent.ToString()),
+			FText::AsCultureInvariant(Context),
+			FText::AsCultureInvariant(ContainingAsset->GetPathName())));
+	}
+#endif
+}
+
+#if WITH_EDITOR
+uint32 FAkGameplayCueCompiledBurst::CurrentEditGeneration = 0;
+#endif
+
 FAkGameplayCueNotify_BurstEffects::FAkGameplayCueNotify_BurstEffects()
 {
 }
@@ -148,36 +743,238 @@ void FAkGameplayCueNotify_BurstEffects::ExecuteEffects(
 	const FGameplayCueNotify_SpawnContext& SpawnContext,
 	FAkGameplayCueNotify_SpawnResult& OutSpawnResult) const
 {
+	OutSpawnResult.Reset();
+
+	ExecuteCompiledEffects(SpawnContext, &OutSpawnResult);
+}
+
+void FAkGameplayCueNotify_BurstEffects::ExecuteEffectsFireAndForget(
+	const FGameplayCueNotify_SpawnContext& SpawnContext) const
+{
+	ExecuteCompiledEffects(SpawnContext, nullptr);
+}
+
+void FAkGameplayCueNotify_BurstEffects::ExecuteCompiledEffects(
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	FAkGameplayCueNotify_SpawnResult* OutSpawnResult) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_ExecuteEffects);
+
 	if (!SpawnContext.World)
 	{
 		UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCueNotify: Trying to execute Burst effects with a NULL world."))
 		return;
 	}
 
+	if (!CompiledBurst.IsUpToDate())
+	{
+		CompileBurst();
+	}
 
-	// We need to store them in the engine SpawnResult struct to later populate them into the Ak one.
-	FGameplayCueNotify_SpawnResult EngineSpawnResult;
+	const EAkGameplayCueBurstSlots Slots = CompiledBurst.Slots;
+	if (Slots != EAkGameplayCueBurstSlots::None)
+	{
+		// The engine spawn functions always hand back what they spawned, fire and forget executions lend them a scratch result.
+		TOptional<AkGameplayCueNotify_Private::FScopedReusedSpawnResult> ScratchSpawnResult;
+		if (!OutSpawnResult)
+		{
+			ScratchSpawnResult.Emplace();
+		}
 
-	for (const FGameplayCueNotify_ParticleInfo& ParticleInfo : BurstParticles)
+		// The engine spawn functions only know about the engine SpawnResult struct, so lend it our buffers to fill in place.
+		AkGameplayCueTypes_Private::FScopedEngineSpawnResult EngineSpawnResult(OutSpawnResult ? *OutSpawnResult : ScratchSpawnResult->SpawnResult);
+
+		if (EnumHasAnyFlags(Slots, EAkGameplayCueBurstSlots::Particles))
+		{
+			const UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(SpawnContext.World);
+			const float ParticleCullDistance = UAkGameplayCueSettings::Get()->BurstParticleCullDistance;
+
+			for (const FGameplayCueNotify_ParticleInfo& ParticleInfo : BurstParticles)
+			{
+				const FGameplayCueNotify_PlacementInfo& PlacementInfo = SpawnContext.GetPlacementInfo(ParticleInfo.bOverridePlacementInfo, ParticleInfo.PlacementInfoOverride);
+				if (!AkGameplayCueTypes_Private::IsEffectCulled(CueSubsystem, SpawnContext, PlacementInfo, ParticleCullDistance))
+				{
+					ParticleInfo.PlayParticleEffect(SpawnContext, EngineSpawnResult.Get());
+				}
+				else
+				{
+					// The engine adds one entry per slot, null if nothing spawned.  Blueprints index the spawn result by slot.
+					EngineSpawnResult.Get().FxSystemComponents.Add(nullptr);
+				}
+			}
+		}
+
+		if (EnumHasAnyFlags(Slots, EAkGameplayCueBurstSlots::CameraShake))
+		{
+			BurstCameraShake.PlayCameraShake(SpawnContext, EngineSpawnResult.Get());
+		}
+
+		if (EnumHasAnyFlags(Slots, EAkGameplayCueBurstSlots::CameraLensEffect))
+		{
+			BurstCameraLensEffect.PlayCameraLensEffect(SpawnContext, EngineSpawnResult.Get());
+		}
+
+		if (EnumHasAnyFlags(Slots, EAkGameplayCueBurstSlots::ForceFeedback))
+		{
+			BurstForceFeedback.PlayForceFeedback(SpawnContext, EngineSpawnResult.Get());
+		}
+
+		if (EnumHasAnyFlags(Slots, EAkGameplayCueBurstSlots::DeviceProperties))
+		{
+			BurstDevicePropertyEffect.SetDeviceProperties(SpawnContext, EngineSpawnResult.Get());
+		}
+
+		if (EnumHasAnyFlags(Slots, EAkGameplayCueBurstSlots::Decal))
+		{
+			BurstDecal.SpawnDecal(SpawnContext, EngineSpawnResult.Get());
+		}
+	}
+
+	// Empty slots keep their invalid ID, so the list stays in slot order for blueprint users.
+	if (OutSpawnResult)
 	{
-		ParticleInfo.PlayParticleEffect(SpawnContext, EngineSpawnResult);
+		OutSpawnResult->AkEventIDs.SetNumZeroed(CompiledBurst.NumAkEventSlots);
 	}
 
-	BurstCameraShake.PlayCameraShake(SpawnContext, EngineSpawnResult);
-	BurstCameraLensEffect.PlayCameraLensEffect(SpawnContext, EngineSpawnResult);
-	BurstForceFeedback.PlayForceFeedback(SpawnContext, EngineSpawnResult);
-	BurstDevicePropertyEffect.SetDeviceProperties(SpawnContext, EngineSpawnResult);
-	BurstDecal.SpawnDecal(SpawnContext, EngineSpawnResult);
+	if (CompiledBurst.AkEvents.IsEmpty())
+	{
+		return;
+	}
 
-	// Populate the ak spawn result
-	OutSpawnResult.SetFromEngineSpawnResult(EngineSpawnResult);
+	AkPlayingID DiscardedEventID = AK_INVALID_PLAYING_ID;
 
-	for (const FAkGameplayCueNotify_AkEventInfo& AkEvent : BurstAkEvents)
+	// Results of the shared records, filled in by the first Ak event using them.
+	enum class ERecordState : uint8 { Unknown, Passed, Failed };
+	TArray<ERecordState, TInlineAllocator<4>> ConditionStates;
+	TArray<ERecordState, TInlineAllocator<4>> PlacementStates;
+	TArray<FTransform, TInlineAllocator<4>> SpawnTransforms;
+	ConditionStates.SetNumZeroed(CompiledBurst.ConditionSlots.Num());
+	PlacementStates.SetNumZeroed(CompiledBurst.PlacementSlots.Num());
+	SpawnTransforms.SetNum(CompiledBurst.PlacementSlots.Num());
+
+	for (const FAkGameplayCueCompiledBurst::FAkEvent& CompiledEvent : CompiledBurst.AkEvents)
 	{
-		AkEvent.PostEvent(SpawnContext, OutSpawnResult);
+		SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_PostEvent);
+
+		const FAkGameplayCueNotify_AkEventInfo& ConditionSlot = BurstAkEvents[CompiledBurst.ConditionSlots[CompiledEvent.ConditionIndex]];
+		const FGameplayCueNotify_SpawnCondition& SpawnCondition = SpawnContext.GetSpawnCondition(ConditionSlot.bOverrideSpawnCondition, ConditionSlot.SpawnConditionOverride);
+
+		// Conditions with a chance to play roll for every slot, sharing the roll would tie the slots together.
+		ERecordState& ConditionState = ConditionStates[CompiledEvent.ConditionIndex];
+		if ((ConditionState == ERecordState::Unknown) || (SpawnCondition.ChanceToPlay < 1.f))
+		{
+			ConditionState = SpawnCondition.ShouldSpawn(SpawnContext) ? ERecordState::Passed : ERecordState::Failed;
+		}
+
+		if (ConditionState == ERecordState::Failed)
+		{
+			continue;
+		}
+
+		const FAkGameplayCueNotify_AkEventInfo& PlacementSlot = BurstAkEvents[CompiledBurst.PlacementSlots[CompiledEvent.PlacementIndex]];
+		const FGameplayCueNotify_PlacementInfo& PlacementInfo = SpawnContext.GetPlacementInfo(PlacementSlot.bOverridePlacementInfo, PlacementSlot.PlacementInfoOverride);
+
+		ERecordState& PlacementState = PlacementStates[CompiledEvent.PlacementIndex];
+		if (PlacementState == ERecordState::Unknown)
+		{
+			PlacementState = PlacementInfo.FindSpawnTransform(SpawnContext, SpawnTransforms[CompiledEvent.PlacementIndex]) ? ERecordState::Passed : ERecordState::Failed;
+		}
+
+		if (PlacementState == ERecordState::Failed)
+		{
+			continue;
+		}
+
+		bool bCulled = false;
+		AkPlayingID& EventID = OutSpawnResult ? OutSpawnResult->AkEventIDs[CompiledEvent.SlotIndex] : DiscardedEventID;
+		BurstAkEvents[CompiledEvent.SlotIndex].TryPostPlacedEvent(SpawnContext, PlacementInfo, SpawnTransforms[CompiledEvent.PlacementIndex], EventID, bCulled);
+
+		if (bCulled && OutSpawnResult)
+		{
+			OutSpawnResult->MarkAkEventCulled(CompiledEvent.SlotIndex);
+		}
 	}
 }
 
+void FAkGameplayCueNotify_BurstEffects::CompileBurst() const
+{
+	FAkGameplayCueCompiledBurst& Compiled = CompiledBurst;
+	Compiled = FAkGameplayCueCompiledBurst();
+
+	// Empty particle slots still get their null entry in the spawn result, like the engine's uncompiled path.
+	if (!BurstParticles.IsEmpty())
+	{
+		Compiled.Slots |= EAkGameplayCueBurstSlots::Particles;
+	}
+
+	if (BurstCameraShake.CameraShake)
+	{
+		Compiled.Slots |= EAkGameplayCueBurstSlots::CameraShake;
+	}
+
+	if (BurstCameraLensEffect.CameraLensEffect)
+	{
+		Compiled.Slots |= EAkGameplayCueBurstSlots::CameraLensEffect;
+	}
+
+	if (BurstForceFeedback.ForceFeedbackEffect)
+	{
+		Compiled.Slots |= EAkGameplayCueBurstSlots::ForceFeedback;
+	}
+
+	if (!BurstDevicePropertyEffect.DeviceProperties.IsEmpty())
+	{
+		Compiled.Slots |= EAkGameplayCueBurstSlots::DeviceProperties;
+	}
+
+	if (BurstDecal.DecalMaterial)
+	{
+		Compiled.Slots |= EAkGameplayCueBurstSlots::Decal;
+	}
+
+	// Overrides are compared by value, through the reflected properties of the slot.
+	static const FProperty* ConditionProperty = FAkGameplayCueNotify_AkEventInfo::StaticStruct()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FAkGameplayCueNotify_AkEventInfo, SpawnConditionOverride));
+	static const FProperty* PlacementProperty = FAkGameplayCueNotify_AkEventInfo::StaticStruct()->FindPropertyByName(GET_MEMBER_NAME_CHECKED(FAkGameplayCueNotify_AkEventInfo, PlacementInfoOverride));
+
+	const auto FindOrAddRecord = [this](TArray<int32, TInlineAllocator<2>>& RecordSlots, int32 SlotIndex, const FProperty* Property, auto IsOverridden) -> uint16
+	{
+		const FAkGameplayCueNotify_AkEventInfo& Slot = BurstAkEvents[SlotIndex];
+		const int32 RecordIndex = RecordSlots.IndexOfByPredicate([this, &Slot, Property, &IsOverridden](int32 RecordSlotIndex)
+		{
+			const FAkGameplayCueNotify_AkEventInfo& RecordSlot = BurstAkEvents[RecordSlotIndex];
+			if (IsOverridden(Slot) != IsOverridden(RecordSlot))
+			{
+				return false;
+			}
+
+			return !IsOverridden(Slot) || Property->Identical_InContainer(&Slot, &RecordSlot);
+		});
+
+		return static_cast<uint16>((RecordIndex != INDEX_NONE) ? RecordIndex : RecordSlots.Add(SlotIndex));
+	};
+
+	Compiled.NumAkEventSlots = BurstAkEvents.Num();
+
+	for (int32 SlotIndex = 0; SlotIndex < BurstAkEvents.Num(); ++SlotIndex)
+	{
+		if (BurstAkEvents[SlotIndex].AkEvent.IsNull())
+		{
+			continue;
+		}
+
+		FAkGameplayCueCompiledBurst::FAkEvent& CompiledEvent = Compiled.AkEvents.AddDefaulted_GetRef();
+		CompiledEvent.SlotIndex = SlotIndex;
+		CompiledEvent.ConditionIndex = FindOrAddRecord(Compiled.ConditionSlots, SlotIndex, ConditionProperty, [](const FAkGameplayCueNotify_AkEventInfo& Slot) { return !!Slot.bOverrideSpawnCondition; });
+		CompiledEvent.PlacementIndex = FindOrAddRecord(Compiled.PlacementSlots, SlotIndex, PlacementProperty, [](const FAkGameplayCueNotify_AkEventInfo& Slot) { return !!Slot.bOverridePlacementInfo; });
+	}
+
+	Compiled.bCompiled = true;
+
+#if WITH_EDITOR
+	Compiled.EditGeneration = FAkGameplayCueCompiledBurst::CurrentEditGeneration;
+#endif
+}
+
 void FAkGameplayCueNotify_BurstEffects::ValidateAssociatedAssets(
 	const UObject* ContainingAsset,
 	const FString& Context,
@@ -199,6 +996,16 @@ void FAkGameplayCueNotify_BurstEffects::ValidateAssociatedAssets(
 	BurstDevicePropertyEffect.ValidateBurstAssets(ContainingAsset, Context + TEXT(".BurstDevicePropertyEffect"), ValidationContext);
 }
 
+void FAkGameplayCueNotify_BurstEffects::PrefetchAkEvents() const
+{
+	for (const FAkGameplayCueNotify_AkEventInfo& AkEvent : BurstAkEvents)
+	{
+		AkEvent.PrefetchAkEvent();
+	}
+
+	CompileBurst();
+}
+
 FAkGameplayCueNotify_LoopingEffects::FAkGameplayCueNotify_LoopingEffects()
 {
 }
@@ -207,37 +1014,46 @@ void FAkGameplayCueNotify_LoopingEffects::StartEffects(
 	const FGameplayCueNotify_SpawnContext& SpawnContext,
 	FAkGameplayCueNotify_SpawnResult& OutSpawnResult) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_StartEffects);
+
 	if (!SpawnContext.World)
 	{
 		UE_LOG(LogAkGameplayCueNotify, Error, TEXT("AkGameplayCueNotify: Trying to start looping effects with a NULL world."))
 		return;
 	}
 
-	// We need to store them in the engine SpawnResult struct to later populate them into the Ak one.
-	FGameplayCueNotify_SpawnResult EngineSpawnResult;
+	OutSpawnResult.Reset();
 
-	for (const FGameplayCueNotify_ParticleInfo& ParticleInfo : LoopingParticles)
 	{
-		ParticleInfo.PlayParticleEffect(SpawnContext, EngineSpawnResult);
-	}
+		// The engine spawn functions only know about the engine SpawnResult struct, so lend it our buffers to fill in place.
+		AkGameplayCueTypes_Private::FScopedEngineSpawnResult EngineSpawnResult(OutSpawnResult);
 
-	LoopingCameraShake.PlayCameraShake(SpawnContext, EngineSpawnResult);
-	LoopingCameraLensEffect.PlayCameraLensEffect(SpawnContext, EngineSpawnResult);
-	LoopingForceFeedback.PlayForceFeedback(SpawnContext, EngineSpawnResult);
-	LoopingInputDevicePropertyEffect.SetDeviceProperties(SpawnContext, EngineSpawnResult);
+		for (const FGameplayCueNotify_ParticleInfo& ParticleInfo : LoopingParticles)
+		{
+			ParticleInfo.PlayParticleEffect(SpawnContext, EngineSpawnResult.Get());
+		}
 
-	// Populate the ak spawn result
-	OutSpawnResult.SetFromEngineSpawnResult(EngineSpawnResult);
+		LoopingCameraShake.PlayCameraShake(SpawnContext, EngineSpawnResult.Get());
+		LoopingCameraLensEffect.PlayCameraLensEffect(SpawnContext, EngineSpawnResult.Get());
+		LoopingForceFeedback.PlayForceFeedback(SpawnContext, EngineSpawnResult.Get());
+		LoopingInputDevicePropertyEffect.SetDeviceProperties(SpawnContext, EngineSpawnResult.Get());
+	}
 
+	int32 NumLoopingIDs = 0;
 	for (const FAkGameplayCueNotify_AkEventInfo& AkEvent : LoopingAkEvents)
 	{
 		AkEvent.PostEvent(SpawnContext, OutSpawnResult);
+		NumLoopingIDs += (OutSpawnResult.AkEventIDs.Last() != AK_INVALID_PLAYING_ID) ? 1 : 0;
 	}
+
+	AkGameplayCueStats::RecordLiveLoopingIDs(NumLoopingIDs);
 }
 
 void FAkGameplayCueNotify_LoopingEffects::StopEffects(
 	FAkGameplayCueNotify_SpawnResult& SpawnResult) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_AkGameplayCue_StopEffects);
+
 	// Stop all particle effects
 	for (UFXSystemComponent* FxSc : SpawnResult.FxSystemComponents)
 	{
@@ -264,10 +1080,15 @@ void FAkGameplayCueNotify_LoopingEffects::StopEffects(
 				FadeInterpolation = static_cast<AkCurveInterpolation>(EventInfo->LoopingFadeOutInterpolation);
 			}
 
-			FAkAudioDevice::Get()->StopPlayingID(PlayingId, FadeDurationMs, FadeInterpolation);
+			FAkGameplayCueLiveIDRegistry::Get().Stop(PlayingId, FadeDurationMs, FadeInterpolation);
+
+			AkGameplayCueStats::RecordLiveLoopingIDs(-1);
 		}
 	}
 
+	// Culled events were never started, and must not start late anymore.
+	SpawnResult.CulledAkEvents = 0;
+
 	// Stop all camera shakes
 	for (UCameraShakeBase* CameraShake : SpawnResult.CameraShakes)
 	{
@@ -306,11 +1127,50 @@ void FAkGameplayCueNotify_LoopingEffects::StopEffects(
 	SpawnResult.Reset();
 }
 
+bool FAkGameplayCueNotify_LoopingEffects::StartCulledEffects(
+	const FGameplayCueNotify_SpawnContext& SpawnContext,
+	FAkGameplayCueNotify_SpawnResult& SpawnResult) const
+{
+	int32 NumLoopingIDs = 0;
+	for (int32 IdIndex = 0; SpawnResult.HasCulledAkEvents() && (IdIndex < SpawnResult.AkEventIDs.Num()); ++IdIndex)
+	{
+		if (!SpawnResult.IsAkEventCulled(IdIndex) || !LoopingAkEvents.IsValidIndex(IdIndex))
+		{
+			continue;
+		}
+
+		bool bCulled = false;
+		const AkPlayingID PlayingId = LoopingAkEvents[IdIndex].RetryCulledPost(SpawnContext, bCulled);
+		if (!bCulled)
+		{
+			SpawnResult.ClearAkEventCulled(IdIndex);
+			SpawnResult.AkEventIDs[IdIndex] = PlayingId;
+			NumLoopingIDs += (PlayingId != AK_INVALID_PLAYING_ID) ? 1 : 0;
+		}
+	}
+
+	AkGameplayCueStats::RecordLiveLoopingIDs(NumLoopingIDs);
+
+	return SpawnResult.HasCulledAkEvents();
+}
+
 void FAkGameplayCueNotify_LoopingEffects::ValidateAssociatedAssets(
 	const UObject* ContainingAsset,
 	const FString& Context,
 	class FDataValidationContext& ValidationContext) const
 {
+	for (const FAkGameplayCueNotify_AkEventInfo& AkEvent : LoopingAkEvents)
+	{
+		AkEvent.ValidateLoopingAssets(ContainingAsset, Context + TEXT(".LoopingAkEvents"), ValidationContext);
+	}
+}
+
+void FAkGameplayCueNotify_LoopingEffects::PrefetchAkEvents() const
+{
+	for (const FAkGameplayCueNotify_AkEventInfo& AkEvent : LoopingAkEvents)
+	{
+		AkEvent.PrefetchAkEvent();
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,243 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AkAudioEvent.h"
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueCountingMalloc.h"
+#include "AkGameplayCueNotify_Burst.h"
+#include "AkGameplayCueSubsystem.h"
+#include "AkGameplayCueTypes.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Package.h"
+#include "Wwise/API/WwiseSoundEngineAPI.h"
+
+namespace AkGameplayCueAllocationTest
+{
+	/** Ak event slots of the tested burst, the most the compiled burst keeps inline. */
+	constexpr int32 NumAkEvents = 4;
+
+	/** Upper bound of measured executions per path. */
+	constexpr int32 MaxMeasuredExecutions = 16;
+
+	/** Game world with a subsystem that went through begin play, like the one cues execute in. */
+	struct FScopedTestWorld
+	{
+		FScopedTestWorld()
+		{
+			World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AkGameplayCueAllocationTest"));
+
+			FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+			WorldContext.SetCurrentWorld(World);
+
+			World->InitializeActorsForPlay(FURL());
+			World->BeginPlay();
+		}
+
+		~FScopedTestWorld()
+		{
+			GEngine->DestroyWorldContext(World);
+			World->DestroyWorld(false);
+		}
+
+		UWorld* World = nullptr;
+	};
+
+	/** Returns a one-shot event of the project that the sound engine knows, so the measured posts succeed. */
+	UAkAudioEvent* FindPostableEvent()
+	{
+		TArray<FAssetData> EventAssets;
+		IAssetRegistry::GetChecked().GetAssetsByClass(UAkAudioEvent::StaticClass()->GetClassPathName(), EventAssets);
+
+		for (const FAssetData& EventAsset : EventAssets)
+		{
+			UAkAudioEvent* Event = Cast<UAkAudioEvent>(EventAsset.GetAsset());
+			if (Event && !Event->IsInfinite && (Event->GetShortID() != AK_INVALID_UNIQUE_ID))
+			{
+				return Event;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/** Fills the protected Ak event slots of the burst effects, there is no other way to author them outside of the editor. */
+	void SetBurstAkEvents(FAkGameplayCueNotify_BurstEffects& BurstEffects, const TArray<FAkGameplayCueNotify_AkEventInfo>& AkEvents)
+	{
+		const FArrayProperty* AkEventsProperty = FindFProperty<FArrayProperty>(FAkGameplayCueNotify_BurstEffects::StaticStruct(), TEXT("BurstAkEvents"));
+		check(AkEventsProperty);
+
+		*AkEventsProperty->ContainerPtrToValuePtr<TArray<FAkGameplayCueNotify_AkEventInfo>>(&BurstEffects) = AkEvents;
+	}
+
+	/**
+	 * Number of executions that fit into the free emitters of the pool.
+	 * Nothing ticks during the test, so no emitter comes back, and growing the pool past its initial size allocates.
+	 */
+	int32 GetNumMeasuredExecutions(UAkGameplayCueSubsystem* CueSubsystem)
+	{
+		const FAkGameplayCueEmitterPoolStats& PoolStats = CueSubsystem->GetEmitterPool().GetStats();
+		return FMath::Min((PoolStats.NumEmitters - PoolStats.NumInUse) / NumAkEvents, MaxMeasuredExecutions);
+	}
+
+	/** Runs Execute NumExecutions times under the counting malloc and returns the number of game thread allocations. */
+	template<typename ExecuteType>
+	uint64 CountAllocations(int32 NumExecutions, ExecuteType&& Execute)
+	{
+		FAkGameplayCueCountingMalloc& CountingMalloc = FAkGameplayCueCountingMalloc::Get();
+
+		CountingMalloc.Install();
+		const uint64 StartAllocations = CountingMalloc.GetNumAllocations();
+
+		for (int32 Index = 0; Index < NumExecutions; ++Index)
+		{
+			Execute();
+		}
+
+		CountingMalloc.Uninstall();
+		return CountingMalloc.GetNumAllocations() - StartAllocations;
+	}
+}
+
+/**
+ * Warm burst executions must not allocate on the game thread.
+ *
+ *	Covers bursts of up to four Ak events, both fire and forget through the notify and into a reused spawn result, posting
+ *	a real event of the project on pooled emitters.  Needs an initialized sound engine and the emitter pool, skipped otherwise.
+ *	Out of scope, since they keep per-post bookkeeping: coalescing, clustering, concurrency limits, infinite events
+ *	(live ID registry, loop aggregation), async posting, queued loads, deferred dispatch and particle spawning (engine components).
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAkGameplayCueBurstAllocationTest, "WwiseGameplayCues.Burst.ZeroAllocations", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FAkGameplayCueBurstAllocationTest::RunTest(const FString& Parameters)
+{
+	using namespace AkGameplayCueAllocationTest;
+
+	IWwiseSoundEngineAPI* SoundEngine = IWwiseSoundEngineAPI::Get();
+	if (!SoundEngine || !SoundEngine->IsInitialized())
+	{
+		AddWarning(TEXT("The sound engine isn't initialized, only successful posts are worth measuring."));
+		return true;
+	}
+
+	UAkAudioEvent* Event = FindPostableEvent();
+	if (!Event)
+	{
+		AddWarning(TEXT("The project has no one-shot Ak event to post."));
+		return true;
+	}
+
+	const FScopedTestWorld TestWorld;
+	UWorld* World = TestWorld.World;
+
+	UAkGameplayCueSubsystem* CueSubsystem = UAkGameplayCueSubsystem::Get(World);
+	if (!TestNotNull(TEXT("Cue subsystem"), CueSubsystem))
+	{
+		return false;
+	}
+
+	const FAkGameplayCueEmitterPoolStats& PoolStats = CueSubsystem->GetEmitterPool().GetStats();
+	if (PoolStats.NumEmitters == 0)
+	{
+		AddWarning(TEXT("The emitter pool is disabled, posts fall back to transient game objects."));
+		return true;
+	}
+
+	AActor* Target = World->SpawnActor<AActor>();
+	USceneComponent* TargetRoot = NewObject<USceneComponent>(Target, TEXT("Root"));
+	Target->SetRootComponent(TargetRoot);
+	TargetRoot->RegisterComponent();
+
+	TArray<FAkGameplayCueNotify_AkEventInfo> AkEvents;
+	for (int32 Index = 0; Index < NumAkEvents; ++Index)
+	{
+		AkEvents.AddDefaulted_GetRef().AkEvent = Event;
+	}
+
+	UAkGameplayCueNotify_Burst* Notify = NewObject<UAkGameplayCueNotify_Burst>(GetTransientPackage(), NAME_None, RF_Transient);
+	const FStructProperty* BurstEffectsProperty = FindFProperty<FStructProperty>(UAkGameplayCueNotify_Burst::StaticClass(), TEXT("BurstEffects"));
+	check(BurstEffectsProperty);
+	SetBurstAkEvents(*BurstEffectsProperty->ContainerPtrToValuePtr<FAkGameplayCueNotify_BurstEffects>(Notify), AkEvents);
+
+	FAkGameplayCueNotify_BurstEffects BurstEffects;
+	SetBurstAkEvents(BurstEffects, AkEvents);
+
+	const FGameplayCueParameters CueParameters;
+	const FGameplayCueNotify_SpawnCondition SpawnCondition;
+	const FGameplayCueNotify_PlacementInfo PlacementInfo;
+	FAkGameplayCueNotify_SpawnResult SpawnResult;
+	int32 NumFailedPosts = 0;
+
+	const auto ExecuteNotify = [Notify, Target, &CueParameters]()
+	{
+		Notify->HandleGameplayCue(Target, EGameplayCueEvent::Executed, CueParameters);
+	};
+
+	const auto ExecuteIntoSpawnResult = [World, Target, &CueParameters, &SpawnCondition, &PlacementInfo, &BurstEffects, &SpawnResult, &NumFailedPosts]()
+	{
+		FGameplayCueNotify_SpawnContext SpawnContext(World, Target, CueParameters);
+		SpawnContext.SetDefaultSpawnCondition(&SpawnCondition);
+		SpawnContext.SetDefaultPlacementInfo(&PlacementInfo);
+
+		BurstEffects.ExecuteEffects(SpawnContext, SpawnResult);
+
+		for (const AkPlayingID PlayingID : SpawnResult.AkEventIDs)
+		{
+			NumFailedPosts += (PlayingID == AK_INVALID_PLAYING_ID) ? 1 : 0;
+		}
+
+		SpawnResult.Reset();
+	};
+
+	// Async posts queue their commands, which allocates.
+	const FAkGameplayCueAsyncPoster::FScopedSynchronousPosts SynchronousPosts(true);
+
+	// The first executions compile the bursts, prefetch the events and size the reused buffers.
+	ExecuteNotify();
+	ExecuteIntoSpawnResult();
+
+	// Pooled emitters stay in use until their end of event is processed, which nothing does during the test.
+	const int32 NumNotifyExecutions = GetNumMeasuredExecutions(CueSubsystem) / 2;
+	const int32 StartInUse = PoolStats.NumInUse;
+	const uint64 NumNotifyAllocations = CountAllocations(NumNotifyExecutions, ExecuteNotify);
+	const int32 NumNotifyPosts = PoolStats.NumInUse - StartInUse;
+
+	const int32 NumSpawnResultExecutions = GetNumMeasuredExecutions(CueSubsystem);
+	NumFailedPosts = 0;
+	const uint64 NumSpawnResultAllocations = CountAllocations(NumSpawnResultExecutions, ExecuteIntoSpawnResult);
+
+	if ((NumNotifyExecutions == 0) || (NumSpawnResultExecutions == 0))
+	{
+		AddWarning(TEXT("The emitter pool is too small to measure warm executions, raise EmitterPoolSize."));
+		return true;
+	}
+
+	// Allocation counts of failed posts would only cover the early outs.
+	const bool bNotifyPostsSucceeded = TestEqual(TEXT("Successful posts of warm fire and forget executions"), NumNotifyPosts, NumNotifyExecutions * NumAkEvents);
+	const bool bSpawnResultPostsSucceeded = TestEqual(TEXT("Failed posts of warm executions into a reused spawn result"), NumFailedPosts, 0);
+	if (!bNotifyPostsSucceeded || !bSpawnResultPostsSucceeded)
+	{
+		return false;
+	}
+
+	if (!FAkGameplayCueCountingMalloc::Get().CountsAllocations())
+	{
+		AddWarning(TEXT("FMemory doesn't allocate through GMalloc in this build, allocations can't be counted."));
+		return true;
+	}
+
+	TestEqual(TEXT("Game thread allocations of warm fire and forget executions"), NumNotifyAllocations, static_cast<uint64>(0));
+	TestEqual(TEXT("Game thread allocations of warm executions into a reused spawn result"), NumSpawnResultAllocations, static_cast<uint64>(0));
+
+	return true;
+}
+
+#endif
@@ -2,14 +2,46 @@
 
 #include "WwiseGameplayCuesModule.h"
 
+#include "AkGameplayCueAsyncPoster.h"
+#include "AkGameplayCueEventPreloader.h"
+#include "AkGameplayCueLiveIDRegistry.h"
+#include "AkGameplayCueStopQueue.h"
+#include "AkGameplayCueTypes.h"
+
 #define LOCTEXT_NAMESPACE "WwiseGameplayCues"
 
 void FWwiseGameplayCuesModule::StartupModule()
 {
+	FAkGameplayCueEventPreloader::Get().Initialize();
+	FAkGameplayCueAsyncPoster::Get().Initialize();
+	FAkGameplayCueStopQueue::Get().Initialize();
+	FAkGameplayCueLiveIDRegistry::Get().Initialize();
+
+#if WITH_EDITOR
+	// Any edit may change the slots of burst effects, wherever they are embedded.  Recompiling them on their next execution is cheap.
+	ObjectPropertyChangedHandle = FCoreUObjectDelegates::OnObjectPropertyChanged.AddLambda([](UObject*, FPropertyChangedEvent&)
+	{
+		++FAkGameplayCueCompiledBurst::CurrentEditGeneration;
+	});
+
+	ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*>&)
+	{
+		++FAkGameplayCueCompiledBurst::CurrentEditGeneration;
+	});
+#endif
 }
 
 void FWwiseGameplayCuesModule::ShutdownModule()
 {
+#if WITH_EDITOR
+	FCoreUObjectDelegates::OnObjectPropertyChanged.Remove(ObjectPropertyChangedHandle);
+	FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+#endif
+
+	FAkGameplayCueLiveIDRegistry::Get().Shutdown();
+	FAkGameplayCueAsyncPoster::Get().Shutdown();
+	FAkGameplayCueStopQueue::Get().Shutdown();
+	FAkGameplayCueEventPreloader::Get().Shutdown();
 }
 
 #undef LOCTEXT_NAMESPACE
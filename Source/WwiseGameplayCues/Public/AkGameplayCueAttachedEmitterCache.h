@@ -0,0 +1,89 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+class AActor;
+class UAkComponent;
+class USceneComponent;
+class UWorld;
+
+/**
+ * FAkGameplayCueAttachedEmitterCache
+ *
+ *	Ak components that attached posts of a world play on, one per (component, socket).
+ *	Components are taken from a pool that is filled when the world starts, so the first cue on a fresh actor doesn't create
+ *	and register a component.  Once the target is destroyed its components are stopped and go back to the pool.
+ */
+class FAkGameplayCueAttachedEmitterCache
+{
+public:
+	FAkGameplayCueAttachedEmitterCache() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueAttachedEmitterCache);
+
+	/** Fills the pool and hooks actor spawns for pre-warming. */
+	void Initialize(UWorld& World);
+
+	/** Destroys all pooled components. */
+	void Deinitialize();
+
+	/** Returns the emitter for the socket of the component, attaching one if needed.  Null if the cache is disabled. */
+	UAkComponent* FindOrAdd(USceneComponent* AttachComponent, FName SocketName);
+
+	/** Returns the emitters of destroyed targets to the pool.  Called once per frame. */
+	void ReleaseDestroyedTargets();
+
+	/**
+	 * Attaches a new emitter to the socket of the component that destroys itself once its events ended.
+	 * For posts that set switches, which would stick to a shared emitter and carry over to later cues on the socket.
+	 */
+	static UAkComponent* SpawnDedicated(USceneComponent* AttachComponent, FName SocketName);
+
+	int32 GetNumCached() const
+	{
+		return CachedEmitters.Num();
+	}
+
+	int32 GetNumFree() const
+	{
+		return FreeEmitters.Num();
+	}
+
+private:
+	struct FKey
+	{
+		TObjectKey<USceneComponent> AttachComponent;
+		FName SocketName;
+
+		bool operator==(const FKey& Other) const
+		{
+			return (AttachComponent == Other.AttachComponent) && (SocketName == Other.SocketName);
+		}
+
+		friend uint32 GetTypeHash(const FKey& Key)
+		{
+			return HashCombineFast(GetTypeHash(Key.AttachComponent), GetTypeHash(Key.SocketName));
+		}
+	};
+
+	struct FCachedEmitter
+	{
+		TWeakObjectPtr<USceneComponent> AttachComponent;
+		TWeakObjectPtr<UAkComponent> Emitter;
+
+		/** False if the emitter belongs to the target itself, those are used but never pooled. */
+		bool bPooled;
+	};
+
+	UAkComponent* CreateEmitter();
+	void OnActorSpawned(AActor* Actor);
+
+	TMap<FKey, FCachedEmitter> CachedEmitters;
+	TArray<TWeakObjectPtr<UAkComponent>> FreeEmitters;
+
+	TWeakObjectPtr<UWorld> World;
+	FDelegateHandle ActorSpawnedHandle;
+};
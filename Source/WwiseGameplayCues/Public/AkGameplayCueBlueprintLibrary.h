@@ -0,0 +1,34 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueTypes.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "AkGameplayCueBlueprintLibrary.generated.h"
+
+#define UE_API WWISEGAMEPLAYCUES_API
+
+class UAkAudioEvent;
+
+/**
+ * UAkGameplayCueBlueprintLibrary
+ *
+ *	Blueprint access to the Ak gameplay cue types.
+ */
+UCLASS(MinimalAPI)
+class UAkGameplayCueBlueprintLibrary : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Returns the Ak event of the info if it is loaded, otherwise null.
+	 * AkEvent is a soft reference, graphs that read it as an Ak event can use this instead.
+	 */
+	UFUNCTION(BlueprintPure, Category = "GameplayCueNotify", meta = (DisplayName = "Get Ak Event"))
+	static UE_API UAkAudioEvent* GetAkEvent(const FAkGameplayCueNotify_AkEventInfo& AkEventInfo);
+};
+
+#undef UE_API
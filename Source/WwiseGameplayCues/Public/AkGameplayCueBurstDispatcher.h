@@ -0,0 +1,94 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueTypes.h"
+#include "GameplayEffectTypes.h"
+
+class AActor;
+class UAkGameplayCueNotify_Burst;
+
+/** Counters of a burst dispatcher, since the world started. */
+struct FAkGameplayCueBurstDispatcherStats
+{
+	uint64 NumImmediate = 0;
+	uint64 NumDeferred = 0;
+	uint64 NumDeferredRun = 0;
+	uint64 NumDropped = 0;
+	int32 PeakQueued = 0;
+};
+
+/**
+ * FAkGameplayCueBurstDispatcher
+ *
+ *	Spreads the executions of UAkGameplayCueNotify_Burst over frames when a world executes more of them than the frame's budget allows.
+ *	High priority bursts always run right away.  Other bursts are queued once the budget is spent (or bursts of their priority are
+ *	queued already), then run in priority order by later frames as budget allows, and dropped once they are later than the notify tolerates.
+ *	Game thread only.
+ */
+class FAkGameplayCueBurstDispatcher
+{
+public:
+	FAkGameplayCueBurstDispatcher() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueBurstDispatcher);
+
+	/** Returns true if a burst of the given priority has to wait for a later frame. */
+	bool ShouldDefer(EAkGameplayCueDispatchPriority Priority);
+
+	/** Queues a burst for a later frame.  It is dropped if it can't run within MaxDelay seconds. */
+	void Defer(const UAkGameplayCueNotify_Burst* Notify, AActor* Target, const FGameplayCueParameters& Parameters, EAkGameplayCueDispatchPriority Priority, float MaxDelay, double Now);
+
+	/** Runs queued bursts until the frame's budget is spent.  Called once per frame. */
+	void Tick(double Now);
+
+	/** Drops all queued bursts. */
+	void Reset();
+
+	/** Logs the counters and the number of queued bursts. */
+	void Dump() const;
+
+	/** Charges the time spent while alive against the frame's budget. */
+	struct FScopedExecution
+	{
+		explicit FScopedExecution(FAkGameplayCueBurstDispatcher* InDispatcher);
+		~FScopedExecution();
+
+		UE_NONCOPYABLE(FScopedExecution);
+
+	private:
+		FAkGameplayCueBurstDispatcher* Dispatcher;
+		uint64 StartCycles;
+	};
+
+	const FAkGameplayCueBurstDispatcherStats& GetStats() const
+	{
+		return Stats;
+	}
+
+	int32 GetNumQueued() const;
+
+private:
+	struct FDeferredBurst
+	{
+		TWeakObjectPtr<const UAkGameplayCueNotify_Burst> Notify;
+		TWeakObjectPtr<AActor> Target;
+		FGameplayCueParameters Parameters;
+		double ExpireTime = 0.0;
+		bool bHasTarget = false;
+	};
+
+	/** Starts a new budget on the first call of each frame. */
+	void UpdateFrame();
+
+	bool IsBudgetSpent() const;
+
+	/** Queued bursts per deferrable priority (Normal, Low), oldest first. */
+	TArray<FDeferredBurst> Queues[2];
+
+	uint64 BudgetFrame = MAX_uint64;
+	uint64 SpentCycles = 0;
+
+	FAkGameplayCueBurstDispatcherStats Stats;
+};
@@ -0,0 +1,59 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StaticArray.h"
+#include "GameplayTagContainer.h"
+
+class AActor;
+struct FGameplayCueParameters;
+
+/**
+ * FAkGameplayCueDuplicateFilter
+ *
+ *	Recognizes the second execution of a burst cue that reaches a predicting client twice, once predicted and once from the server.
+ *	Only predicted executions are recorded, and only a later non-predicted execution matching one of them is a duplicate.
+ *	Executions are identified by a hash of the cue tag, target and the parameters that survive replication, and remembered for a short window
+ *	in a fixed-size table, so lookups never lock or allocate and the memory use is the same no matter how many cues fire.
+ *	Game thread only.
+ */
+class FAkGameplayCueDuplicateFilter
+{
+public:
+	FAkGameplayCueDuplicateFilter() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueDuplicateFilter);
+
+	/** Identifies an execution of a cue.  Never 0. */
+	static uint64 MakeKey(const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters);
+
+	/** Remembers a predicted execution for the window.  When the table is full around the key, the record closest to expiring is replaced. */
+	void Record(uint64 Key, double Now, float WindowSeconds);
+
+	/** Returns true if the same execution was recorded less than its window ago, consuming the record so a third execution runs again. */
+	bool Consume(uint64 Key, double Now);
+
+	/** Forgets all records. */
+	void Reset();
+
+	uint64 GetNumSuppressed() const
+	{
+		return NumSuppressed;
+	}
+
+private:
+	struct FRecord
+	{
+		uint64 Key = 0;
+		double ExpireTime = 0.0;
+	};
+
+	static constexpr int32 NumRecords = 1024;
+	static constexpr int32 MaxProbes = 8;
+	static_assert(FMath::IsPowerOfTwo(NumRecords), "The record index is masked from the key.");
+
+	TStaticArray<FRecord, NumRecords> Records;
+
+	uint64 NumSuppressed = 0;
+};
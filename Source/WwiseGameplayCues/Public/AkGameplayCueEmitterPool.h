@@ -0,0 +1,106 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueEndOfEventQueue.h"
+
+#include <AK/SoundEngine/Common/AkTypedefs.h>
+
+class UAkAudioEvent;
+struct FAkGameplayCueBoundParameters;
+
+/** Usage counters of an emitter pool. */
+struct FAkGameplayCueEmitterPoolStats
+{
+	/** Number of registered emitters. */
+	int32 NumEmitters = 0;
+
+	/** Number of emitters currently playing at least one event. */
+	int32 NumInUse = 0;
+
+	/** Highest NumInUse seen. */
+	int32 PeakInUse = 0;
+
+	/** Number of location posts that went through the pool. */
+	uint64 NumRequests = 0;
+
+	/** Number of requests served by an already registered emitter. */
+	uint64 NumHits = 0;
+
+	/** Number of requests that had to register an additional emitter. */
+	uint64 NumGrows = 0;
+
+	/** Number of requests that found the pool exhausted and fell back or were rejected. */
+	uint64 NumOverflows = 0;
+
+	float GetHitRate() const
+	{
+		return (NumRequests > 0) ? static_cast<float>(static_cast<double>(NumHits) / static_cast<double>(NumRequests)) : 1.f;
+	}
+};
+
+/**
+ * FAkGameplayCueEmitterPool
+ *
+ *	Pre-registered Wwise game objects used for non-attached posts.
+ *	Posting through the pool avoids registering and unregistering a transient game object for every post.
+ *	An emitter is borrowed for a post and returned once the sound engine reports the end of the event.
+ */
+class FAkGameplayCueEmitterPool
+{
+public:
+	FAkGameplayCueEmitterPool() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueEmitterPool);
+
+	/** Registers the initial emitters with the sound engine. */
+	void Initialize();
+
+	/** Stops everything playing on pooled emitters and unregisters them. */
+	void Deinitialize();
+
+	/**
+	 * Posts the event at the given transform on a pooled emitter.
+	 * The emitter plays nothing else until the event ends, so the caller may move it through OutGameObjectID.
+	 * The bound switches are set on the emitter before posting.
+	 * @return False if the pool can't serve the post and the caller should use a transient game object.
+	 */
+	bool PostAtLocation(const UAkAudioEvent* Event, const FTransform& Transform, AkPlayingID& OutPlayingID, AkGameObjectID* OutGameObjectID = nullptr, const FAkGameplayCueBoundParameters* BoundParameters = nullptr);
+
+	/** Returns emitters whose events finished, optionally reporting the playing IDs that finished and the emitters that went back to the pool.  Called once per frame. */
+	void ProcessFinishedEvents(TArray<AkPlayingID>* OutFinishedPlayingIDs = nullptr, TArray<AkGameObjectID>* OutReleasedEmitters = nullptr);
+
+	const FAkGameplayCueEmitterPoolStats& GetStats() const
+	{
+		return Stats;
+	}
+
+private:
+	struct FEmitter
+	{
+		AkGameObjectID GameObjectID;
+		int32 NumActiveEvents;
+
+		/** Set once a post applied bound switches, which would otherwise carry over to the next post on the emitter. */
+		bool bSwitchesSet;
+	};
+
+	/** Registers a new emitter and adds it to the free list.  Returns false if the sound engine isn't available. */
+	bool RegisterEmitter();
+
+	/** Returns an emitter to the free list once nothing plays on it anymore. */
+	void ReleaseEmitter(int32 EmitterIndex);
+
+	/** Puts the switch groups of an idle emitter back to their defaults. */
+	void ResetSwitches(FEmitter& Emitter);
+
+	TArray<FEmitter> Emitters;
+	TArray<int32> FreeEmitters;
+	TMap<AkGameObjectID, int32> GameObjectToEmitter;
+
+	FAkGameplayCueEndOfEventQueue EndOfEventQueue;
+	FAkGameplayCueEmitterPoolStats Stats;
+
+	bool bInitialized = false;
+};
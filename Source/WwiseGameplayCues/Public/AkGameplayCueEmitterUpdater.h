@@ -0,0 +1,65 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <AK/SoundEngine/Common/AkTypes.h>
+
+class USceneComponent;
+
+/**
+ * FAkGameplayCueEmitterUpdater
+ *
+ *	Moves the emitters of non-attached looping Ak events along with their target, so the notify actors don't have to tick.
+ *	All followed emitters of a world are kept in one array and updated in a single pass per frame.
+ *	Each emitter updates at its own interval, emitters far from every listener are throttled further.
+ *	An emitter is dropped once its target goes away or its pool takes it back.
+ */
+class FAkGameplayCueEmitterUpdater
+{
+public:
+	FAkGameplayCueEmitterUpdater() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueEmitterUpdater);
+
+	/** Starts moving the emitter along with the component, keeping the offset of the spawn transform to it.  An interval of 0 updates every frame. */
+	void Add(AkGameObjectID GameObjectID, const USceneComponent* FollowComponent, const FTransform& SpawnTransform, float UpdateInterval, double Now);
+
+	/** Stops moving the emitters, e.g. because their pool took them back. */
+	void Remove(TConstArrayView<AkGameObjectID> GameObjectIDs);
+
+	/** Pushes the positions of all emitters that are due to the sound engine.  Called once per frame. */
+	void Tick(double Now, TConstArrayView<FVector> ListenerLocations);
+
+	/** Drops all emitters. */
+	void Reset();
+
+	bool IsEmpty() const
+	{
+		return FollowedEmitters.IsEmpty();
+	}
+
+	int32 GetNumFollowed() const
+	{
+		return FollowedEmitters.Num();
+	}
+
+private:
+	struct FFollowedEmitter
+	{
+		AkGameObjectID GameObjectID;
+		TWeakObjectPtr<const USceneComponent> FollowComponent;
+
+		/** Relative to the follow component. */
+		FTransform RelativeTransform;
+
+		/** Last transform handed to the sound engine, unchanged transforms aren't sent again. */
+		FTransform LastTransform;
+
+		double NextUpdateTime;
+		float UpdateInterval;
+	};
+
+	TArray<FFollowedEmitter> FollowedEmitters;
+};
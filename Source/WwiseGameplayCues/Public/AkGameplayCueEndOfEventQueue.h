@@ -0,0 +1,58 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+
+#include <AK/SoundEngine/Common/AkCallback.h>
+
+/** An Ak event instance that reached its end. */
+struct FAkGameplayCueFinishedEvent
+{
+	AkPlayingID PlayingID;
+	AkGameObjectID GameObjectID;
+};
+
+/**
+ * FAkGameplayCueEndOfEventQueue
+ *
+ *	Marshals AK_EndOfEvent callbacks from the audio thread to the game thread through a lock-free queue.
+ *	Post events with AK_EndOfEvent, OnEventCallback and GetCookie(), then drain the queue on the game thread.
+ *	Posts may go to the sound engine directly or through FAkAudioDevice, CancelCallbacks covers both.
+ */
+class FAkGameplayCueEndOfEventQueue
+{
+public:
+	FAkGameplayCueEndOfEventQueue() = default;
+	~FAkGameplayCueEndOfEventQueue();
+
+	UE_NONCOPYABLE(FAkGameplayCueEndOfEventQueue);
+
+	/** Sound engine callback.  Runs on the audio thread. */
+	static void OnEventCallback(AkCallbackType CallbackType, AkCallbackInfo* CallbackInfo);
+
+	/** Cookie to pass along with OnEventCallback when posting. */
+	void* GetCookie()
+	{
+		return this;
+	}
+
+	/** Pops the next finished event.  Game thread only. */
+	bool Dequeue(FAkGameplayCueFinishedEvent& OutFinishedEvent)
+	{
+		return FinishedEvents.Dequeue(OutFinishedEvent);
+	}
+
+	/** Reports an event that will never send its end of event callback, e.g. a post that failed on another thread.  Thread safe. */
+	void Enqueue(const FAkGameplayCueFinishedEvent& FinishedEvent)
+	{
+		FinishedEvents.Enqueue(FinishedEvent);
+	}
+
+	/** Makes sure no more callbacks reach this queue.  Pending entries are discarded. */
+	void CancelCallbacks();
+
+private:
+	TQueue<FAkGameplayCueFinishedEvent, EQueueMode::Mpsc> FinishedEvents;
+};
@@ -0,0 +1,72 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+
+#include <AK/SoundEngine/Common/AkTypedefs.h>
+
+class AActor;
+class UAkAudioEvent;
+struct FAkGameplayCueNotify_ConcurrencyInfo;
+
+/**
+ * FAkGameplayCueInstanceTracker
+ *
+ *	Plugin-side bookkeeping of live Ak event instances that have concurrency limits, per world.
+ *	Only events with limits are tracked, everything else never touches the tracker.
+ *	Game thread only.
+ */
+class FAkGameplayCueInstanceTracker
+{
+public:
+	FAkGameplayCueInstanceTracker() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueInstanceTracker);
+
+	/**
+	 * Checks the limits for a new instance of the given event.
+	 * Depending on the policy, this either rejects the new instance or stops the oldest instances in the exceeded scopes.
+	 * @return True if the event may be posted.
+	 */
+	bool AcquireSlot(const FAkGameplayCueNotify_ConcurrencyInfo& Concurrency, const UAkAudioEvent* Event, const AActor* Target, const AActor* Instigator);
+
+	/** Starts tracking a posted instance.  Finite events are released automatically once their maximum duration, or the fallback lifetime, elapsed. */
+	void TrackInstance(AkPlayingID PlayingID, const UAkAudioEvent* Event, const AActor* Target, const AActor* Instigator, bool bStopsWithTarget);
+
+	/** Stops tracking an instance, freeing its slot.  Safe to call for untracked IDs. */
+	void ReleaseInstance(AkPlayingID PlayingID);
+
+	/** Forgets all instances without stopping them. */
+	void Reset();
+
+	bool HasInstances() const
+	{
+		return !PlayingIdToEvent.IsEmpty();
+	}
+
+private:
+	struct FInstance
+	{
+		AkPlayingID PlayingID;
+		TWeakObjectPtr<const AActor> Target;
+		TObjectKey<AActor> TargetKey;
+		TObjectKey<AActor> InstigatorKey;
+		double ExpireTime;
+		bool bStopsWithTarget;
+	};
+
+	/** Removes instances that are known to be finished. */
+	void PruneInstances(TArray<FInstance>& Instances, double Now);
+
+	/** Stops the oldest instance matching the predicate.  Returns false if there was none. */
+	template <typename PredicateType>
+	bool StopOldestInstance(TArray<FInstance>& Instances, PredicateType Predicate);
+
+	/** Live instances per event, oldest first. */
+	TMap<TObjectKey<UAkAudioEvent>, TArray<FInstance>> EventInstances;
+
+	/** Reverse lookup used to release instances by playing ID. */
+	TMap<AkPlayingID, TObjectKey<UAkAudioEvent>> PlayingIdToEvent;
+};
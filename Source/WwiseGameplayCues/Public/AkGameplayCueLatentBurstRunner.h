@@ -0,0 +1,53 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+
+class AActor;
+class UAkGameplayCueNotify_BurstSequence;
+
+/**
+ * FAkGameplayCueLatentBurstRunner
+ *
+ *	Runs the follow-up bursts of UAkGameplayCueNotify_BurstSequence executions of a world.
+ *	Each running sequence is a plain pooled object, so hundreds of them cost no actors, timers or allocations in steady state.
+ */
+class FAkGameplayCueLatentBurstRunner
+{
+public:
+	FAkGameplayCueLatentBurstRunner() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCueLatentBurstRunner);
+
+	/** Starts running the follow-ups of a sequence whose initial burst was just spawned. */
+	void Start(const UAkGameplayCueNotify_BurstSequence* Notify, AActor* Target, const FGameplayCueParameters& Parameters, double Now);
+
+	/** Spawns all follow-ups that are due.  Called once per frame. */
+	void Tick(double Now);
+
+	/** Drops all running sequences. */
+	void Reset();
+
+	int32 GetNumRunning() const
+	{
+		return RunningBursts.Num();
+	}
+
+private:
+	struct FLatentBurst
+	{
+		TWeakObjectPtr<const UAkGameplayCueNotify_BurstSequence> Notify;
+		TWeakObjectPtr<AActor> Target;
+		FGameplayCueParameters Parameters;
+		double StartTime = 0.0;
+		int32 NextFollowUpIndex = 0;
+		bool bHasTarget = false;
+		bool bFinished = false;
+	};
+
+	/** Executing a follow-up may start other sequences, so running bursts are stable heap objects. */
+	TArray<TUniquePtr<FLatentBurst>> RunningBursts;
+	TArray<TUniquePtr<FLatentBurst>> FreeBursts;
+};
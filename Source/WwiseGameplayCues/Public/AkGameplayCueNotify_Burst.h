@@ -18,6 +18,9 @@
  *	Since it is not instanced, it cannot do latent actions such as delays and timelines.
  *
  *	Supporting Ak (Wwise) audio events.
+ *
+ *	Once warm, executions of up to four Ak events make no game thread allocations (WwiseGameplayCues.Burst.ZeroAllocations).
+ *	Coalescing, clustering, concurrency limits, infinite events, async posting and particles keep per-post state and may allocate.
  */
 UCLASS(Blueprintable, Category="GameplayCueNotify", MinimalAPI, meta=(ShowWorldContextPin, DisplayName="Ak GCN Burst", ShortTooltip="A one-off GameplayCueNotify that is never spawned into the world."))
 class UAkGameplayCueNotify_Burst : public UGameplayCueNotify_Static
@@ -27,7 +30,17 @@ class UAkGameplayCueNotify_Burst : public UGameplayCueNotify_Static
 public:
 	UE_API UAkGameplayCueNotify_Burst();
 
+	/** Starts loading and preparing the Ak events of this notify in the background. */
+	UE_API void PrefetchAkEvents() const;
+
+	/** Spawns the burst effects.  Called on execute, or by the burst dispatcher for deferred bursts. */
+	UE_API void ExecuteBurst(AActor* Target, const FGameplayCueParameters& Parameters) const;
+
 protected:
+	//~ Begin UObject Interface
+	UE_API virtual void PostLoad() override;
+	//~ End UObject Interface
+
 	//~ Begin UGameplayCueNotify_Static Interface
 	UE_API virtual bool OnExecute_Implementation(AActor* MyTarget, const FGameplayCueParameters& Parameters) const override;
 
@@ -39,6 +52,9 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent)
 	UE_API void OnBurst(AActor* Target, const FGameplayCueParameters& Parameters, const FAkGameplayCueNotify_SpawnResult& SpawnResult) const;
 
+	/** Returns true if executions have to collect what they spawned and call OnBurst. */
+	UE_API bool NeedsSpawnResult() const;
+
 protected:
 	/** Default condition to check before spawning anything.  Applies for all spawns unless overridden. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
@@ -48,9 +64,40 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
 	FGameplayCueNotify_PlacementInfo DefaultPlacementInfo;
 
+	/**
+	 * If enabled, an execution from the server that matches one this client predicted within DuplicateWindow is skipped before any effect work.
+	 * Meant for cues that reach the predicting client twice, once predicted and once from the server.  Other executions are never skipped.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
+	bool bSuppressPredictedDuplicates;
+
+	/** How long (in seconds) after an execution an identical one counts as its duplicate.  Should cover the round trip time to the server. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults", meta = (ClampMin = "0.0", Units = "s", EditCondition = "bSuppressPredictedDuplicates"))
+	float DuplicateWindow;
+
+	/**
+	 * If enabled, executions don't collect the spawned components and playing IDs, and OnBurst is never called.
+	 * Classes that don't implement OnBurst execute this way regardless.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
+	bool bFireAndForget;
+
 	/** List of effects to spawn on burst. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Effects")
 	FAkGameplayCueNotify_BurstEffects BurstEffects;
+
+	/** How urgent the burst is once the frame's dispatch budget is spent.  Only High priority bursts are guaranteed to run in the frame they were executed. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Dispatch")
+	EAkGameplayCueDispatchPriority DispatchPriority;
+
+	/** How late (in seconds) a deferred burst may still run.  It is dropped once it waited longer. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Dispatch", meta = (ClampMin = "0.0", Units = "s", EditCondition = "DispatchPriority != EAkGameplayCueDispatchPriority::High"))
+	float MaxDispatchDelay;
+
+private:
+	/** Whether the class implements OnBurst.  Looked up once the class is loaded, or on first execution. */
+	mutable bool bOnBurstImplemented;
+	mutable bool bOnBurstLookedUp;
 };
 
 #undef UE_API
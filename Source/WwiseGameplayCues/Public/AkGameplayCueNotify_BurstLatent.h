@@ -29,7 +29,18 @@ class AAkGameplayCueNotify_BurstLatent : public AGameplayCueNotify_Actor
 public:
 	UE_API AAkGameplayCueNotify_BurstLatent(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	/** Starts loading and preparing the Ak events of this notify in the background. */
+	UE_API void PrefetchAkEvents() const;
+
 protected:
+	//~ Begin UObject Interface
+	UE_API virtual void PostLoad() override;
+	//~ End UObject Interface
+
+	//~ Begin AActor Interface
+	UE_API virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	//~ End AActor Interface
+
 	//~ Begin AGameplayCueNotify_Actor Interface
 	UE_API virtual bool Recycle() override;
 	UE_API virtual bool OnExecute_Implementation(AActor* MyTarget, const FGameplayCueParameters& Parameters) override;
@@ -51,6 +62,24 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
 	FGameplayCueNotify_PlacementInfo DefaultPlacementInfo;
 
+	/**
+	 * If enabled, the notify is recycled as soon as its burst's Ak events and FX systems have ended, instead of after its lifetime.
+	 * The lifetime still applies as an upper bound.  Leave disabled if the blueprint runs latent actions that outlive the effects.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
+	bool bRecycleWhenEffectsFinish;
+
+	/**
+	 * If enabled, an execution from the server that matches one this client predicted within DuplicateWindow is skipped before any effect work.
+	 * Meant for cues that reach the predicting client twice, once predicted and once from the server.  Other executions are never skipped.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
+	bool bSuppressPredictedDuplicates;
+
+	/** How long (in seconds) after an execution an identical one counts as its duplicate.  Should cover the round trip time to the server. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults", meta = (ClampMin = "0.0", Units = "s", EditCondition = "bSuppressPredictedDuplicates"))
+	float DuplicateWindow;
+
 	/** List of effects to spawn on burst. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Effects")
 	FAkGameplayCueNotify_BurstEffects BurstEffects;
@@ -58,6 +87,13 @@ protected:
 	/** Results of spawned burst effects. */
 	UPROPERTY(BlueprintReadOnly, Category = "GCN Effects")
 	FAkGameplayCueNotify_SpawnResult BurstSpawnResults;
+
+private:
+	void AcquirePreallocatorUsage();
+	void ReleasePreallocatorUsage();
+
+	/** Set while this instance counts towards the live instances of its class in the preallocation profile. */
+	bool bCountedByPreallocator = false;
 };
 
 #undef UE_API
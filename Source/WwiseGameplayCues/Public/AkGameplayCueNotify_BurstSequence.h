@@ -0,0 +1,101 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueTypes.h"
+#include "GameplayCueNotifyTypes.h"
+#include "GameplayCueNotify_Static.h"
+
+#include "AkGameplayCueNotify_BurstSequence.generated.h"
+
+#define UE_API WWISEGAMEPLAYCUES_API
+
+/**
+ * FAkGameplayCueNotify_FollowUpBurst
+ *
+ *	Set of burst effects spawned some time after the initial burst of a sequence.
+ */
+USTRUCT(BlueprintType)
+struct FAkGameplayCueNotify_FollowUpBurst
+{
+	GENERATED_BODY()
+
+	UE_API FAkGameplayCueNotify_FollowUpBurst();
+
+public:
+	/** Time (in seconds) after the initial burst to spawn the effects at. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify, Meta = (ClampMin = "0.0", Units = "s"))
+	float Delay;
+
+	/** Effects to spawn. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	FAkGameplayCueNotify_BurstEffects BurstEffects;
+};
+
+/**
+ * UAkGameplayCueNotify_BurstSequence
+ *
+ *	This is a non-instanced gameplay cue notify for one-off effects with delayed follow-ups.
+ *	The follow-ups are run by the world's Ak gameplay cue subsystem, so no actor is spawned or held for the lifetime of the sequence.
+ *	Use it instead of AAkGameplayCueNotify_BurstLatent when the latent part is just a series of timed bursts.
+ *
+ *	Supporting Ak (Wwise) audio events.
+ */
+UCLASS(Blueprintable, Category="GameplayCueNotify", MinimalAPI, meta=(ShowWorldContextPin, DisplayName="Ak GCN Burst Sequence", ShortTooltip="A one-off GameplayCueNotify with timed follow-up bursts that is never spawned into the world."))
+class UAkGameplayCueNotify_BurstSequence : public UGameplayCueNotify_Static
+{
+	GENERATED_BODY()
+
+public:
+	UE_API UAkGameplayCueNotify_BurstSequence();
+
+	/** Starts loading and preparing the Ak events of this notify in the background. */
+	UE_API void PrefetchAkEvents() const;
+
+	/** Spawns the follow-up burst at the given index.  Called by the latent burst runner. */
+	UE_API void ExecuteFollowUp(int32 FollowUpIndex, AActor* Target, const FGameplayCueParameters& Parameters) const;
+
+	const TArray<FAkGameplayCueNotify_FollowUpBurst>& GetFollowUpBursts() const
+	{
+		return FollowUpBursts;
+	}
+
+protected:
+	//~ Begin UObject Interface
+	UE_API virtual void PostLoad() override;
+	//~ End UObject Interface
+
+	//~ Begin UGameplayCueNotify_Static Interface
+	UE_API virtual bool OnExecute_Implementation(AActor* MyTarget, const FGameplayCueParameters& Parameters) const override;
+
+#if WITH_EDITOR
+	UE_API virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+	//~ End UGameplayCueNotify_Static Interface
+
+	UFUNCTION(BlueprintImplementableEvent)
+	UE_API void OnBurst(AActor* Target, const FGameplayCueParameters& Parameters, const FAkGameplayCueNotify_SpawnResult& SpawnResult) const;
+
+	UFUNCTION(BlueprintImplementableEvent)
+	UE_API void OnFollowUpBurst(AActor* Target, const FGameplayCueParameters& Parameters, int32 FollowUpIndex, const FAkGameplayCueNotify_SpawnResult& SpawnResult) const;
+
+protected:
+	/** Default condition to check before spawning anything.  Only checked for the initial burst, follow-ups always run. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
+	FGameplayCueNotify_SpawnCondition DefaultSpawnCondition;
+
+	/** Default placement rules.  Applies for all spawns unless overridden. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Defaults")
+	FGameplayCueNotify_PlacementInfo DefaultPlacementInfo;
+
+	/** List of effects to spawn on burst. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Effects")
+	FAkGameplayCueNotify_BurstEffects BurstEffects;
+
+	/** Effects to spawn after the burst, in order of their delay.  The sequence stops early if the target goes away. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Effects")
+	TArray<FAkGameplayCueNotify_FollowUpBurst> FollowUpBursts;
+};
+
+#undef UE_API
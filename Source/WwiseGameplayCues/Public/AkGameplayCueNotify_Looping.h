@@ -28,7 +28,17 @@ class AAkGameplayCueNotify_Looping : public AGameplayCueNotify_Actor
 public:
 	UE_API AAkGameplayCueNotify_Looping(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
+	/** Starts loading and preparing the Ak events of this notify in the background. */
+	UE_API void PrefetchAkEvents() const;
+
+	/** Starts the looping Ak events that were culled when the loop started and are in range now.  Returns true while any of them remain culled. */
+	UE_API bool StartCulledLoopingEffects();
+
 protected:
+	/** ~ Begin UObject Interface */
+	UE_API virtual void PostLoad() override;
+	/** ~ End UObject Interface */
+
 	/** ~ Begin AGameplayCueNotify_Actor Interface */
 	UE_API virtual bool Recycle() override;
 
@@ -91,6 +101,13 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "GCN Recurring Effects (On Execute)")
 	FAkGameplayCueNotify_SpawnResult RecurringSpawnResults;
 
+	/**
+	 * If enabled, the notify is recycled as soon as its removal effects' Ak events and FX systems have ended,
+	 * instead of after the auto destroy delay.  The delay still applies as an upper bound.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Removal Effects (On Remove)")
+	bool bRecycleWhenRemovalEffectsFinish;
+
 	/** List of effects to spawn on removal.  These should not be looping effects! */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GCN Removal Effects (On Remove)")
 	FAkGameplayCueNotify_BurstEffects RemovalEffects;
@@ -100,6 +117,17 @@ protected:
 	FAkGameplayCueNotify_SpawnResult RemovalSpawnResults;
 
 	bool bLoopingEffectsRemoved;
+
+	/** Target and parameters of the loop start, kept to start culled looping Ak events late. */
+	TWeakObjectPtr<AActor> LoopingTarget;
+	FGameplayCueParameters LoopingParameters;
+
+private:
+	void AcquirePreallocatorUsage();
+	void ReleasePreallocatorUsage();
+
+	/** Set while this instance counts towards the live instances of its class in the preallocation profile. */
+	bool bCountedByPreallocator = false;
 };
 
 #undef UE_API
@@ -0,0 +1,70 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/SoftObjectPath.h"
+
+class AGameplayCueNotify_Actor;
+class UWorld;
+
+/**
+ * FAkGameplayCuePreallocator
+ *
+ *	Right-sizes the cue manager's actor pools of Ak gameplay cue notifies per map.
+ *	Records the peak number of concurrent instances per notify class while a map is played and saves it as a profile.
+ *	The next time the map is loaded, the pools are topped up to the profiled peaks, spread over frames within a time budget.
+ */
+class FAkGameplayCuePreallocator
+{
+public:
+	FAkGameplayCuePreallocator() = default;
+
+	UE_NONCOPYABLE(FAkGameplayCuePreallocator);
+
+	/** Loads the profile of the world's map and queues the preallocation. */
+	void Initialize(UWorld& World);
+
+	/** Saves the peaks recorded in this session into the profile of the world's map. */
+	void Deinitialize(UWorld& World);
+
+	/** Spawns queued instances until the per frame budget is used up.  Called once per frame. */
+	void Tick(UWorld& World);
+
+	/** An instance of the notify started playing. */
+	void OnInstanceAcquired(const AGameplayCueNotify_Actor* Instance);
+
+	/** An instance of the notify went back to the pool or was destroyed. */
+	void OnInstanceReleased(const AGameplayCueNotify_Actor* Instance);
+
+	/** Logs the profiled and recorded peaks. */
+	void Dump() const;
+
+private:
+	struct FClassUsage
+	{
+		FSoftClassPath ClassPath;
+		int32 NumLive = 0;
+		int32 PeakLive = 0;
+	};
+
+	struct FPendingPreallocation
+	{
+		FSoftClassPath ClassPath;
+		int32 NumRemaining = 0;
+	};
+
+	static FString GetProfileFilename(const UWorld& World);
+
+	bool bEnabled = false;
+
+	/** Peaks per class loaded from the profile. */
+	TMap<FSoftClassPath, int32> ProfiledPeaks;
+
+	/** Usage per class recorded in this session. */
+	TMap<TObjectKey<UClass>, FClassUsage> ClassUsage;
+
+	/** Instances still to spawn, per class. */
+	TArray<FPendingPreallocation> PendingPreallocations;
+};
@@ -0,0 +1,165 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "AkGameplayCueSettings.generated.h"
+
+#define UE_API WWISEGAMEPLAYCUES_API
+
+/**
+ * EAkGameplayCueEmitterPoolOverflowPolicy
+ *
+ *	What to do when a location post finds no free emitter in the pool.
+ */
+UENUM()
+enum class EAkGameplayCueEmitterPoolOverflowPolicy : uint8
+{
+	/** Register an additional emitter, up to MaxEmitterPoolSize.  Past that, falls back to a transient game object. */
+	Grow,
+
+	/** Post on a transient game object, the same way UAkAudioEvent::PostAtLocation does. */
+	Transient,
+
+	/** Don't post the event. */
+	Reject,
+};
+
+/**
+ * UAkGameplayCueSettings
+ *
+ *	Project wide settings for the Wwise gameplay cue plugin.
+ */
+UCLASS(MinimalAPI, Config = Game, DefaultConfig, meta = (DisplayName = "Wwise Gameplay Cues"))
+class UAkGameplayCueSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UE_API UAkGameplayCueSettings();
+
+	static const UAkGameplayCueSettings* Get()
+	{
+		return GetDefault<UAkGameplayCueSettings>();
+	}
+
+	//~ Begin UDeveloperSettings Interface
+	UE_API virtual FName GetCategoryName() const override;
+	//~ End UDeveloperSettings Interface
+
+public:
+	/** If enabled, non-attached Ak events are posted on pre-registered emitters instead of registering a transient game object per post. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool")
+	bool bUseEmitterPool;
+
+	/** Number of emitters registered per world when it starts. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool", meta = (EditCondition = "bUseEmitterPool", ClampMin = "0"))
+	int32 EmitterPoolSize;
+
+	/** What to do when all pooled emitters are in use. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool", meta = (EditCondition = "bUseEmitterPool"))
+	EAkGameplayCueEmitterPoolOverflowPolicy EmitterPoolOverflowPolicy;
+
+	/** Upper bound on the number of pooled emitters when the pool is allowed to grow. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool", meta = (EditCondition = "bUseEmitterPool && EmitterPoolOverflowPolicy == EAkGameplayCueEmitterPoolOverflowPolicy::Grow", ClampMin = "0"))
+	int32 MaxEmitterPoolSize;
+
+	/** If enabled, attached Ak events play on cached Ak components, one per target component and socket, taken from a per-world pool. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool")
+	bool bCacheAttachedEmitters;
+
+	/** Number of Ak components created per world when it starts, for attached posts. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool", meta = (EditCondition = "bCacheAttachedEmitters", ClampMin = "0"))
+	int32 AttachedEmitterPoolSize;
+
+	/** If enabled, every pawn gets an emitter attached to its root when it spawns, rather than on its first attached cue. */
+	UPROPERTY(Config, EditAnywhere, Category = "Emitter Pool", meta = (EditCondition = "bCacheAttachedEmitters"))
+	bool bPrewarmAttachedEmittersForPawns;
+
+	/** If enabled, Ak events are not posted when every listener is outside of their maximum attenuation radius. */
+	UPROPERTY(Config, EditAnywhere, Category = "Culling")
+	bool bCullByAttenuationRadius;
+
+	/** Added to the attenuation radius before culling, so sounds just outside of it still play when the listener moves closer. */
+	UPROPERTY(Config, EditAnywhere, Category = "Culling", meta = (EditCondition = "bCullByAttenuationRadius", ClampMin = "0.0", Units = "cm"))
+	float AttenuationCullPadding;
+
+	/** Burst particles farther than this from every listener are not spawned.  Zero never culls particles by distance. */
+	UPROPERTY(Config, EditAnywhere, Category = "Culling", meta = (ClampMin = "0.0", Units = "cm"))
+	float BurstParticleCullDistance;
+
+	/** How often (in seconds) looping cues retry to start the Ak events that were culled when they started. */
+	UPROPERTY(Config, EditAnywhere, Category = "Culling", meta = (ClampMin = "0.0", Units = "s"))
+	float CulledLoopRetryInterval;
+
+	/** If enabled, the Ak events of all loaded gameplay cue notifies are prefetched whenever a map finishes loading. */
+	UPROPERTY(Config, EditAnywhere, Category = "Event Preloading")
+	bool bPrefetchOnMapLoad;
+
+	/** How long (in seconds) a post queued by the Queue load policy waits for its event before it is dropped. */
+	UPROPERTY(Config, EditAnywhere, Category = "Event Preloading", meta = (ClampMin = "0.0", Units = "s"))
+	float MaxQueuedPostDelay;
+
+	/**
+	 * If enabled, posts on pooled and cached emitters are handed to a worker task instead of calling the sound engine on the game thread.
+	 * Spawn results then hold handles that resolve to playing IDs once posted.  Clustered posts and posts with concurrency limits stay synchronous.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Async Posting")
+	bool bAsyncPosting;
+
+	/**
+	 * How much time (in milliseconds) per frame and world burst notifies may spend before bursts below High dispatch priority are deferred to later frames.
+	 * 0 runs every burst right away.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Dispatch", meta = (ClampMin = "0.0", Units = "ms"))
+	float BurstDispatchBudgetMs;
+
+	/**
+	 * How long (in seconds) an instance of a one-shot Ak event with concurrency limits holds its slot when the event has no duration data.
+	 * Posts on pooled emitters free their slot as soon as they end, whichever comes first.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Concurrency", meta = (ClampMin = "0.0", Units = "s"))
+	float UnknownDurationInstanceLifetime;
+
+	/**
+	 * If enabled, stops of looping Ak events are gathered and sent to the sound engine together at the end of the frame,
+	 * which keeps mass removals (round ends, level unloads, cleanses) from stopping the same playing IDs over and over.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Looping")
+	bool bBatchLoopingStops;
+
+	/**
+	 * How often (in seconds) infinite Ak events are checked for a notify or target that went away without stopping them.  Orphans are stopped and logged.
+	 * 0 disables the check, orphans then play until their world is torn down.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Looping", meta = (ClampMin = "0.0", Units = "s"))
+	float OrphanSweepInterval;
+
+	/** Emitters of looping Ak events following their target that are farther than this from every listener are updated less often. */
+	UPROPERTY(Config, EditAnywhere, Category = "Looping", meta = (ClampMin = "0.0", Units = "cm"))
+	float FollowThrottleDistance;
+
+	/** How often (in seconds) at most emitters past FollowThrottleDistance are moved to their target. */
+	UPROPERTY(Config, EditAnywhere, Category = "Looping", meta = (ClampMin = "0.0", Units = "s"))
+	float FollowThrottledUpdateInterval;
+
+	/**
+	 * If enabled, the peak number of concurrent instances of each actor notify class is recorded per map,
+	 * and the cue manager's actor pools are topped up to those peaks the next time the map is loaded.
+	 * Profiles are saved to Saved/AkGameplayCues/Preallocation.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Preallocation")
+	bool bAdaptivePreallocation;
+
+	/** How much time (in milliseconds) per frame may be spent spawning preallocated notify actors. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preallocation", meta = (ClampMin = "0.0", Units = "ms", EditCondition = "bAdaptivePreallocation"))
+	float PreallocationBudgetMs;
+
+	/** Upper bound for the profiled peak of a single notify class. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preallocation", meta = (ClampMin = "0", EditCondition = "bAdaptivePreallocation"))
+	int32 MaxPreallocatedInstancesPerClass;
+};
+
+#undef UE_API
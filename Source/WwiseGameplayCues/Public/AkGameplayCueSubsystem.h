@@ -0,0 +1,319 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AkGameplayCueAttachedEmitterCache.h"
+#include "AkGameplayCueBurstDispatcher.h"
+#include "AkGameplayCueDuplicateFilter.h"
+#include "AkGameplayCueEmitterPool.h"
+#include "AkGameplayCueEmitterUpdater.h"
+#include "AkGameplayCueEndOfEventQueue.h"
+#include "AkGameplayCueInstanceTracker.h"
+#include "AkGameplayCueLatentBurstRunner.h"
+#include "AkGameplayCuePreallocator.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+
+#include <AK/SoundEngine/Common/AkTypedefs.h>
+#include <AK/SoundEngine/Common/AkConstants.h>
+
+#include "AkGameplayCueSubsystem.generated.h"
+
+#define UE_API WWISEGAMEPLAYCUES_API
+
+class AAkGameplayCueNotify_Looping;
+class AGameplayCueNotify_Actor;
+class UAkAudioEvent;
+class UFXSystemComponent;
+struct FAkGameplayCueNotify_SpawnResult;
+struct FGameplayCueParameters;
+struct FGameplayCueNotify_SpawnContext;
+
+/** Optional game hook deciding whether a cue effect at the given location is significant enough to spawn.  The range is 0 when it is unknown. */
+DECLARE_DELEGATE_RetVal_ThreeParams(bool, FAkGameplayCueIsSignificant, const FGameplayCueNotify_SpawnContext& /*SpawnContext*/, const FVector& /*Location*/, float /*Range*/);
+
+/**
+ * FAkGameplayCueCoalescingKey
+ *
+ *	Identifies a (event, game object) pair for post coalescing.
+ */
+struct FAkGameplayCueCoalescingKey
+{
+	FAkGameplayCueCoalescingKey(const UAkAudioEvent* InEvent, const UObject* InGameObject, bool bInAttached)
+		: Event(InEvent)
+		, GameObject(InGameObject)
+		, bAttached(bInAttached)
+	{
+	}
+
+	bool operator==(const FAkGameplayCueCoalescingKey& Other) const
+	{
+		return (Event == Other.Event) && (GameObject == Other.GameObject) && (bAttached == Other.bAttached);
+	}
+
+	friend uint32 GetTypeHash(const FAkGameplayCueCoalescingKey& Key)
+	{
+		return HashCombineFast(HashCombineFast(GetTypeHash(Key.Event), GetTypeHash(Key.GameObject)), static_cast<uint32>(Key.bAttached));
+	}
+
+	TObjectKey<UAkAudioEvent> Event;
+	TObjectKey<UObject> GameObject;
+	bool bAttached;
+};
+
+/**
+ * FAkGameplayCueClusterKey
+ *
+ *	Identifies the grid cell of an event's location post for same-frame clustering.
+ */
+struct FAkGameplayCueClusterKey
+{
+	FAkGameplayCueClusterKey(const UAkAudioEvent* InEvent, const FVector& Location, float CellSize)
+		: Event(InEvent)
+		, Cell(ToCell(Location, CellSize))
+	{
+	}
+
+	static FIntVector ToCell(const FVector& Location, float CellSize)
+	{
+		const FVector CellLocation = Location / FMath::Max(CellSize, 1.f);
+		return FIntVector(FMath::FloorToInt32(CellLocation.X), FMath::FloorToInt32(CellLocation.Y), FMath::FloorToInt32(CellLocation.Z));
+	}
+
+	bool operator==(const FAkGameplayCueClusterKey& Other) const
+	{
+		return (Event == Other.Event) && (Cell == Other.Cell);
+	}
+
+	friend uint32 GetTypeHash(const FAkGameplayCueClusterKey& Key)
+	{
+		return HashCombineFast(GetTypeHash(Key.Event), GetTypeHash(Key.Cell));
+	}
+
+	TObjectKey<UAkAudioEvent> Event;
+	FIntVector Cell;
+};
+
+/**
+ * UAkGameplayCueSubsystem
+ *
+ *	World subsystem holding the per-frame state shared by all Ak gameplay cue notifies of a world.
+ */
+UCLASS(MinimalAPI)
+class UAkGameplayCueSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the subsystem for the given world, or null if the world does not support it (e.g. editor preview worlds). */
+	static UE_API UAkGameplayCueSubsystem* Get(const UWorld* World);
+
+	/** Returns the playing ID of a previous post that the given key can be merged into, or AK_INVALID_PLAYING_ID. */
+	UE_API AkPlayingID FindCoalescedPost(const FAkGameplayCueCoalescingKey& Key) const;
+
+	/** Records a post so identical posts inside the window can share its playing ID.  A window of 0 merges same-frame posts only. */
+	UE_API void AddCoalescedPost(const FAkGameplayCueCoalescingKey& Key, AkPlayingID PlayingID, float WindowSeconds);
+
+	/**
+	 * Merges a location post into this frame's cluster of its cell, moving the cluster's emitter to the new centroid.
+	 * @return True if there was a cluster to join, OutPlayingID is then set to its playing ID.
+	 */
+	UE_API bool JoinCluster(const FAkGameplayCueClusterKey& Key, const FVector& Location, AkPlayingID& OutPlayingID);
+
+	/** Starts a cluster with a fresh post.  Without a movable game object later posts still join it, but it stays at its first location. */
+	UE_API void AddCluster(const FAkGameplayCueClusterKey& Key, AkPlayingID PlayingID, AkGameObjectID GameObjectID, const FTransform& SpawnTransform, AkRtpcID ClusterSizeRtpcID);
+
+	/** Returns true if IsCulled could cull anything with the given range, so callers can skip computing a location. */
+	bool CanCull(float Range) const
+	{
+		return (Range > 0.f) || IsSignificantDelegate.IsBound();
+	}
+
+	/** Returns true if an effect of the given range at the location is out of range of every listener, or not significant.  A range of 0 skips the range check. */
+	UE_API bool IsCulled(const FGameplayCueNotify_SpawnContext& SpawnContext, const FVector& Location, float Range) const;
+
+	/** Retries the culled looping Ak events of the notify until they started or its loop ended. */
+	UE_API void AddCulledLoop(AAkGameplayCueNotify_Looping* Notify);
+
+	/**
+	 * Finishes the notify as soon as the Ak events and FX systems of the spawn result have ended.
+	 * Only posts made inside a FScopedCompletionTracking can be observed, the notify's own finish timer covers everything else.
+	 */
+	UE_API void WatchCompletion(AGameplayCueNotify_Actor* Notify, const FAkGameplayCueNotify_SpawnResult& SpawnResult);
+
+	/** Drops the completion watch of the notify, if any.  Called when it is recycled. */
+	UE_API void StopWatchingCompletion(const AGameplayCueNotify_Actor* Notify);
+
+	/** While alive, the posts of this world report their end to the subsystem. */
+	struct FScopedCompletionTracking
+	{
+		explicit FScopedCompletionTracking(UAkGameplayCueSubsystem* InCueSubsystem)
+			: CueSubsystem(InCueSubsystem)
+		{
+			if (CueSubsystem)
+			{
+				++CueSubsystem->CompletionTrackingDepth;
+			}
+		}
+
+		~FScopedCompletionTracking()
+		{
+			if (CueSubsystem)
+			{
+				--CueSubsystem->CompletionTrackingDepth;
+			}
+		}
+
+		UE_NONCOPYABLE(FScopedCompletionTracking);
+
+	private:
+		UAkGameplayCueSubsystem* CueSubsystem;
+	};
+
+	/** Returns true if posts should be made with AK_EndOfEvent, OnEventCallback and GetCompletionCookie(). */
+	bool IsTrackingCompletion() const
+	{
+		return CompletionTrackingDepth > 0;
+	}
+
+	void* GetCompletionCookie()
+	{
+		return CompletionQueue.GetCookie();
+	}
+
+	/** Pre-registered emitters used for non-attached posts. */
+	FAkGameplayCueEmitterPool& GetEmitterPool()
+	{
+		return EmitterPool;
+	}
+
+	/** Ak components attached posts play on, per target component and socket. */
+	FAkGameplayCueAttachedEmitterCache& GetAttachedEmitterCache()
+	{
+		return AttachedEmitterCache;
+	}
+
+	/** Moves the pooled emitters of looping Ak events that follow their target. */
+	FAkGameplayCueEmitterUpdater& GetEmitterUpdater()
+	{
+		return EmitterUpdater;
+	}
+
+	/** Concurrency limits of the Ak events posted in this world. */
+	FAkGameplayCueInstanceTracker& GetInstanceTracker()
+	{
+		return InstanceTracker;
+	}
+
+	/** Runs the follow-up bursts of burst sequence notifies. */
+	FAkGameplayCueLatentBurstRunner& GetLatentBurstRunner()
+	{
+		return LatentBurstRunner;
+	}
+
+	/** Defers low priority bursts once the frame's dispatch budget is spent. */
+	FAkGameplayCueBurstDispatcher& GetBurstDispatcher()
+	{
+		return BurstDispatcher;
+	}
+
+	const FAkGameplayCueDuplicateFilter& GetDuplicateFilter() const
+	{
+		return DuplicateFilter;
+	}
+
+	/**
+	 * Returns true if the burst already ran predicted on this client within the window and now arrives again from the server.
+	 * Predicted executions are recorded and never duplicates themselves.  Always false outside of clients.
+	 */
+	UE_API bool IsDuplicateExecution(const FGameplayTag& CueTag, const AActor* Target, const FGameplayCueParameters& Parameters, float WindowSeconds);
+
+	/** Tops up the cue manager's notify actor pools from the map's usage profile. */
+	FAkGameplayCuePreallocator& GetPreallocator()
+	{
+		return Preallocator;
+	}
+
+	/** Bound by the game to cull cue effects by significance, on top of the range check. */
+	FAkGameplayCueIsSignificant IsSignificantDelegate;
+
+	//~ Begin UTickableWorldSubsystem Interface
+	UE_API virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	UE_API virtual void Deinitialize() override;
+	UE_API virtual void Tick(float DeltaTime) override;
+	UE_API virtual TStatId GetStatId() const override;
+	//~ End UTickableWorldSubsystem Interface
+
+protected:
+	//~ Begin UWorldSubsystem Interface
+	UE_API virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	//~ End UWorldSubsystem Interface
+
+private:
+	struct FCoalescedPost
+	{
+		AkPlayingID PlayingID = AK_INVALID_PLAYING_ID;
+		uint64 PostFrame = 0;
+		double ExpireTime = 0.0;
+	};
+
+	struct FCluster
+	{
+		AkPlayingID PlayingID = AK_INVALID_PLAYING_ID;
+		AkGameObjectID GameObjectID = AK_INVALID_GAME_OBJECT;
+		AkRtpcID ClusterSizeRtpcID = AK_INVALID_RTPC_ID;
+		FTransform Transform;
+		FVector LocationSum = FVector::ZeroVector;
+		int32 NumPosts = 0;
+		uint64 PostFrame = 0;
+	};
+
+	struct FCompletionWatch
+	{
+		TWeakObjectPtr<AGameplayCueNotify_Actor> Notify;
+		TArray<AkPlayingID, TInlineAllocator<4>> PlayingIDs;
+		TArray<TWeakObjectPtr<UFXSystemComponent>, TInlineAllocator<4>> FxSystemComponents;
+	};
+
+	bool IsCoalescedPostAlive(const FCoalescedPost& Post) const;
+	void UpdateListenerLocations() const;
+	void RetryCulledLoops();
+	void ProcessCompletionWatches();
+
+	/** Posts that identical posts can currently be merged into. */
+	TMap<FAkGameplayCueCoalescingKey, FCoalescedPost> CoalescedPosts;
+
+	FAkGameplayCueEmitterPool EmitterPool;
+	FAkGameplayCueAttachedEmitterCache AttachedEmitterCache;
+	FAkGameplayCueEmitterUpdater EmitterUpdater;
+	FAkGameplayCueInstanceTracker InstanceTracker;
+	FAkGameplayCueLatentBurstRunner LatentBurstRunner;
+	FAkGameplayCueBurstDispatcher BurstDispatcher;
+	FAkGameplayCueDuplicateFilter DuplicateFilter;
+	FAkGameplayCuePreallocator Preallocator;
+
+	/** Notifies waiting for their effects to end, and the end of event callbacks of the posts they wait for. */
+	TArray<FCompletionWatch> CompletionWatches;
+	FAkGameplayCueEndOfEventQueue CompletionQueue;
+	int32 CompletionTrackingDepth = 0;
+
+	/** Playing IDs that ended since the last tick.  Kept to reuse its allocation. */
+	TArray<AkPlayingID> FinishedPlayingIDs;
+
+	/** Emitters that went back to the pool since the last tick.  Kept to reuse its allocation. */
+	TArray<AkGameObjectID> ReleasedEmitters;
+
+	/** Clusters of location posts made this frame. */
+	TMap<FAkGameplayCueClusterKey, FCluster> Clusters;
+
+	/** Locations of this world's listeners, gathered once per frame on first use. */
+	mutable TArray<FVector, TInlineAllocator<4>> ListenerLocations;
+	mutable uint64 ListenerLocationsFrame = MAX_uint64;
+
+	/** Looping notifies with Ak events waiting to come in range. */
+	TArray<TWeakObjectPtr<AAkGameplayCueNotify_Looping>> CulledLoops;
+	double NextCulledLoopRetryTime = 0.0;
+};
+
+#undef UE_API
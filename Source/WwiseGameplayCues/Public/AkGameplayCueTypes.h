@@ -11,6 +11,9 @@
 #define UE_API WWISEGAMEPLAYCUES_API
 
 class UAkAudioEvent;
+class UAkRtpc;
+class UAkSwitchValue;
+class UPhysicalMaterial;
 struct FGameplayCueNotify_SpawnContext;
 struct FGameplayCueNotify_SpawnResult;
 
@@ -35,12 +38,42 @@ struct FAkGameplayCueNotify_SpawnResult
 	/** Sets this spawn result from a FGameplayCueNotify_SpawnResult. */
 	UE_API void SetFromEngineSpawnResult(const FGameplayCueNotify_SpawnResult& SpawnResult);
 
+	/** Exchanges the component lists and references with a FGameplayCueNotify_SpawnResult without copying any elements. */
+	UE_API void SwapWithEngineSpawnResult(FGameplayCueNotify_SpawnResult& SpawnResult);
+
+	/** Marks the Ak event ID at the given index as culled for being out of range.  Only the first 64 events are tracked. */
+	void MarkAkEventCulled(int32 Index)
+	{
+		CulledAkEvents |= (Index < 64) ? (1ull << Index) : 0ull;
+	}
+
+	/** Clears the culled mark of the Ak event ID at the given index. */
+	void ClearAkEventCulled(int32 Index)
+	{
+		CulledAkEvents &= (Index < 64) ? ~(1ull << Index) : ~0ull;
+	}
+
+	/** Returns true if the Ak event ID at the given index was culled. */
+	bool IsAkEventCulled(int32 Index) const
+	{
+		return (Index < 64) && ((CulledAkEvents & (1ull << Index)) != 0);
+	}
+
+	/** Returns true if any Ak event was culled. */
+	bool HasCulledAkEvents() const
+	{
+		return CulledAkEvents != 0;
+	}
+
 	/** List of FX components spawned.  There may be null pointers here as it matches the defined order. */
 	UPROPERTY(BlueprintReadOnly, Transient, Category = GameplayCueNotify)
 	TArray<TObjectPtr<UFXSystemComponent>> FxSystemComponents;
 
-	/** List of ak event ID's triggered .  There may be null IDs here as it matches the defined order. */
-	TArray<AkPlayingID> AkEventIDs;
+	/** List of ak event ID's triggered .  There may be null IDs here as it matches the defined order.  Inline storage covers typical cues without allocating. */
+	TArray<AkPlayingID, TInlineAllocator<4>> AkEventIDs;
+
+	/** Bit mask of the entries in AkEventIDs that were culled rather than posted. */
+	uint64 CulledAkEvents;
 
 	/** List of camera shakes played.  There will be one camera shake per local player controller if shake is played in world. */
 	UPROPERTY(BlueprintReadOnly, Transient, Category = GameplayCueNotify)
@@ -63,6 +96,182 @@ struct FAkGameplayCueNotify_SpawnResult
 	TObjectPtr<UDecalComponent> DecalComponent;
 };
 
+/**
+ * EAkGameplayCueConcurrencyPolicy
+ *
+ *	What to do when posting an Ak event would exceed one of its concurrency limits.
+ */
+UENUM(BlueprintType)
+enum class EAkGameplayCueConcurrencyPolicy : uint8
+{
+	/** Don't post the new instance. */
+	RejectNew,
+
+	/** Stop the oldest live instance in the exceeded scope and post the new one. */
+	StopOldest,
+};
+
+/**
+ * FAkGameplayCueNotify_ConcurrencyInfo
+ *
+ *	Limits on how many instances of an Ak event posted by gameplay cues may be alive at once.
+ *	Limits are enforced before posting, so rejected instances never reach the sound engine.
+ */
+USTRUCT(BlueprintType)
+struct FAkGameplayCueNotify_ConcurrencyInfo
+{
+	GENERATED_BODY()
+
+	UE_API FAkGameplayCueNotify_ConcurrencyInfo();
+
+	/** Returns true if any limit is set. */
+	bool HasLimits() const
+	{
+		return (MaxInstancesPerEvent > 0) || (MaxInstancesPerTarget > 0) || (MaxInstancesPerInstigator > 0);
+	}
+
+public:
+	/** Maximum number of live instances of this event.  Zero means unlimited. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify, Meta = (ClampMin = "0"))
+	int32 MaxInstancesPerEvent;
+
+	/** Maximum number of live instances of this event on the same target actor.  Zero means unlimited. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify, Meta = (ClampMin = "0"))
+	int32 MaxInstancesPerTarget;
+
+	/** Maximum number of live instances of this event caused by the same instigator.  Zero means unlimited. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify, Meta = (ClampMin = "0"))
+	int32 MaxInstancesPerInstigator;
+
+	/** What to do when a limit is reached. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	EAkGameplayCueConcurrencyPolicy Policy;
+};
+
+/**
+ * EAkGameplayCueDispatchPriority
+ *
+ *	How urgent a burst is when the frame's cue dispatch budget is spent.
+ */
+UENUM(BlueprintType)
+enum class EAkGameplayCueDispatchPriority : uint8
+{
+	/** Always run in the frame the cue was executed. */
+	High,
+
+	/** Deferred to a later frame once the budget is spent, run before Low bursts. */
+	Normal,
+
+	/** Deferred to a later frame once the budget is spent, run last. */
+	Low,
+};
+
+/**
+ * EAkGameplayCueEventLoadPolicy
+ *
+ *	What to do when an Ak event is posted before it finished loading.  A loaded event is posted while its media is still being prepared.
+ */
+UENUM(BlueprintType)
+enum class EAkGameplayCueEventLoadPolicy : uint8
+{
+	/** Load the event synchronously and post it right away.  Hitches, and logs a warning. */
+	LoadSynchronous,
+
+	/** Don't post the event. */
+	Skip,
+
+	/** Post the event as soon as it is ready, or drop it if that takes too long.  The post reports no playing ID, so infinite events are always dropped. */
+	Queue,
+};
+
+/**
+ * EAkGameplayCueParameterSource
+ *
+ *	Value of the gameplay cue parameters that drives an RTPC.
+ */
+UENUM(BlueprintType)
+enum class EAkGameplayCueParameterSource : uint8
+{
+	RawMagnitude,
+	NormalizedMagnitude,
+	GameplayEffectLevel,
+	AbilityLevel,
+};
+
+/**
+ * FAkGameplayCueNotify_RtpcBinding
+ *
+ *	Sets an RTPC on the posted event from the gameplay cue parameters.
+ */
+USTRUCT(BlueprintType)
+struct FAkGameplayCueNotify_RtpcBinding
+{
+	GENERATED_BODY()
+
+	UE_API FAkGameplayCueNotify_RtpcBinding();
+
+public:
+	/** Parameter the RTPC is set from. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	EAkGameplayCueParameterSource Source;
+
+	/** RTPC to set. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	TObjectPtr<UAkRtpc> Rtpc;
+
+	/** Multiplier applied to the parameter. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	float Scale;
+};
+
+/**
+ * FAkGameplayCueNotify_SwitchBinding
+ *
+ *	Sets a switch on the posted event's game object if the gameplay cue parameters match.
+ */
+USTRUCT(BlueprintType)
+struct FAkGameplayCueNotify_SwitchBinding
+{
+	GENERATED_BODY()
+
+	UE_API FAkGameplayCueNotify_SwitchBinding();
+
+public:
+	/** Physical material the cue parameters must carry.  Matches any if empty. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	TObjectPtr<UPhysicalMaterial> PhysicalMaterial;
+
+	/** Tag the aggregated source tags of the cue parameters must contain.  Matches any if empty. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	FGameplayTag SourceTag;
+
+	/** Switch to set. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	TObjectPtr<UAkSwitchValue> SwitchValue;
+};
+
+/**
+ * FAkGameplayCueBoundParameters
+ *
+ *	Switch and RTPC values of a single post, evaluated from the parameter bindings of its event.
+ */
+struct FAkGameplayCueBoundParameters
+{
+	bool IsEmpty() const
+	{
+		return Switches.IsEmpty() && RtpcValues.IsEmpty();
+	}
+
+	/** Sets the switches on the game object.  Must happen before the post for switch containers to pick them up. */
+	UE_API void ApplySwitches(AkGameObjectID GameObjectID) const;
+
+	/** Sets the RTPCs on the playing ID only, so they don't stick to the game object. */
+	UE_API void ApplyRtpcValues(AkPlayingID PlayingID) const;
+
+	TArray<TPair<AkSwitchGroupID, AkSwitchStateID>, TInlineAllocator<2>> Switches;
+	TArray<TPair<AkRtpcID, AkRtpcValue>, TInlineAllocator<4>> RtpcValues;
+};
+
 /**
  * FAkGameplayCueNotify_EventInfo
  *
@@ -78,6 +287,67 @@ struct FAkGameplayCueNotify_AkEventInfo
 
 	UE_API virtual bool PostEvent(const FGameplayCueNotify_SpawnContext& SpawnContext, FAkGameplayCueNotify_SpawnResult& OutSpawnResult) const;
 	UE_API virtual void ValidateBurstAssets(const UObject* ContainingAsset, const FString& Context, class FDataValidationContext& ValidationContext) const;
+	UE_API virtual void ValidateLoopingAssets(const UObject* ContainingAsset, const FString& Context, class FDataValidationContext& ValidationContext) const;
+
+	/** Starts loading the event and preparing its media in the background. */
+	UE_API void PrefetchAkEvent() const;
+
+	/** Posts the event again after it was culled, without checking the spawn condition again.  Returns the playing ID, bOutCulled is set if it is still culled. */
+	UE_API AkPlayingID RetryCulledPost(const FGameplayCueNotify_SpawnContext& SpawnContext, bool& bOutCulled) const;
+
+	/**
+	 * Posts the event to the sound engine, either on the target actor or at the spawn transform, without applying any of the per-event options.
+	 * OutGameObjectID is set if the event plays on an emitter of its own that the caller may move.
+	 * Attached posts play on the cached emitter of AttachComponent's socket, or of the target's root if no component is given.
+	 */
+	UE_API static AkPlayingID PostToSoundEngine(UAkAudioEvent* Event, UWorld* World, AActor* TargetActor, const FTransform& SpawnTransform, bool bAttachToTarget, AkGameObjectID* OutGameObjectID = nullptr, const FAkGameplayCueBoundParameters* BoundParameters = nullptr, USceneComponent* AttachComponent = nullptr, FName AttachSocketName = NAME_None);
+
+	/** Evaluates the parameter bindings against the cue parameters. */
+	UE_API void BindParameters(const FGameplayCueParameters& Parameters, FAkGameplayCueBoundParameters& OutBoundParameters) const;
+
+	/** TryPostEvent past the spawn condition and the placement, for callers that evaluated those already.  Returns true if the post was handled. */
+	UE_API bool TryPostPlacedEvent(const FGameplayCueNotify_SpawnContext& SpawnContext, const FGameplayCueNotify_PlacementInfo& PlacementInfo, const FTransform& SpawnTransform, AkPlayingID& OutEventID, bool& bOutCulled) const;
+
+protected:
+	/** Shared by PostEvent and RetryCulledPost.  Returns true if the post was handled, bOutCulled is set if it was culled for being out of range. */
+	UE_API bool TryPostEvent(const FGameplayCueNotify_SpawnContext& SpawnContext, bool bCheckSpawnCondition, AkPlayingID& OutEventID, bool& bOutCulled) const;
+
+	/** Returns the event if it is ready to post, otherwise applies the load policy and returns null unless it loaded the event. */
+	UE_API UAkAudioEvent* ResolveAkEvent(const FGameplayCueNotify_SpawnContext& SpawnContext, const FTransform& SpawnTransform, bool bAttachToTarget) const;
+
+	/** Posts a resolved event, merging it into identical posts and enforcing the concurrency limits.  Returns true if the post was handled. */
+	UE_API bool PostResolvedEvent(UAkAudioEvent* Event, const FGameplayCueNotify_SpawnContext& SpawnContext, const FTransform& SpawnTransform, bool bAttachToTarget, AkPlayingID& OutEventID) const;
+
+	/** PostToSoundEngine up to the post itself, setting the bound switches on the game object before posting. */
+	static AkPlayingID PostToSoundEngineWithSwitches(UAkAudioEvent* Event, UWorld* World, AActor* TargetActor, const FTransform& SpawnTransform, bool bAttachToTarget, AkGameObjectID* OutGameObjectID, const FAkGameplayCueBoundParameters* BoundParameters, USceneComponent* AttachComponent, FName AttachSocketName);
+
+	/** Resolves the parameter bindings to Wwise IDs, so posts need no asset lookups. */
+	UE_API void CompileParameterBindings() const;
+
+	struct FCompiledRtpcBinding
+	{
+		AkRtpcID RtpcID;
+		EAkGameplayCueParameterSource Source;
+		float Scale;
+	};
+
+	struct FCompiledSwitchBinding
+	{
+		TWeakObjectPtr<const UPhysicalMaterial> PhysicalMaterial;
+		FGameplayTag SourceTag;
+		AkSwitchGroupID GroupID;
+		AkSwitchStateID StateID;
+	};
+
+	/** Parameter bindings resolved to Wwise IDs.  Compiled once when the owning notify loads, or on first post (again after edits in the editor). */
+	mutable TArray<FCompiledRtpcBinding> CompiledRtpcBindings;
+	mutable TArray<FCompiledSwitchBinding> CompiledSwitchBindings;
+	mutable bool bParameterBindingsCompiled = false;
+
+#if WITH_EDITOR
+	/** FAkGameplayCueCompiledBurst::CurrentEditGeneration the bindings were compiled at. */
+	mutable uint32 ParameterBindingsEditGeneration = 0;
+#endif
 
 public:
 	/** If enabled, use the spawn condition override and not the default one. */
@@ -96,9 +366,16 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify, Meta = (EditCondition = "bOverridePlacementInfo"))
 	FGameplayCueNotify_PlacementInfo PlacementInfoOverride;
 
-	/** The Ak event to trigger. */
+	/**
+	 * The Ak event to trigger.  Loaded and prepared in the background once the notify is loaded.
+	 * Blueprints that need the event itself use UAkGameplayCueBlueprintLibrary::GetAkEvent.
+	 */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
-	TObjectPtr<UAkAudioEvent> AkEvent;
+	TSoftObjectPtr<UAkAudioEvent> AkEvent;
+
+	/** What to do if the event is posted before it is loaded and prepared. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
+	EAkGameplayCueEventLoadPolicy LoadPolicy;
 
 	/** How long it should take to fade out.  Only used on looping gameplay cues. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
@@ -107,6 +384,149 @@ public:
 	/** Interpolation for fading out.	Only used on looping gameplay cues. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
 	EAkCurveInterpolation LoopingFadeOutInterpolation;
+
+	/** If enabled, identical posts of this event on the same target are merged into one and share its playing ID.  Meant for one-shot events. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Coalescing")
+	uint32 bCoalesceDuplicatePosts : 1;
+
+	/** How long (in seconds) a post can be merged into by identical posts.  Zero only merges posts made in the same frame. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Coalescing", Meta = (EditCondition = "bCoalesceDuplicatePosts", ClampMin = "0.0", Units = "s"))
+	float CoalescingWindow;
+
+	/** Limits on live instances of this event, checked before posting. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Concurrency")
+	FAkGameplayCueNotify_ConcurrencyInfo Concurrency;
+
+	/**
+	 * If enabled, all live instances of this event in a world play as one voice on a shared emitter, with one position per instance.
+	 * Only used for infinite events.  Aggregated instances are not coalesced or limited, and their IDs are not sound engine playing IDs.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Aggregation")
+	uint32 bAggregateInstances : 1;
+
+	/** Optional RTPC set on the shared emitter to the number of live instances. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Aggregation", Meta = (EditCondition = "bAggregateInstances"))
+	TObjectPtr<UAkRtpc> InstanceCountRtpc;
+
+	/** If enabled, non-attached posts of this event made in the same frame and grid cell are merged into one post at their centroid.  Meant for one-shot events. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Clustering")
+	uint32 bClusterSameFramePosts : 1;
+
+	/** Size of the grid cells posts are clustered in. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Clustering", Meta = (EditCondition = "bClusterSameFramePosts", ClampMin = "1.0", Units = "cm"))
+	float ClusterCellSize;
+
+	/** Optional RTPC set on the clustered post to the number of posts merged into it. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Clustering", Meta = (EditCondition = "bClusterSameFramePosts"))
+	TObjectPtr<UAkRtpc> ClusterSizeRtpc;
+
+	/**
+	 * If enabled, non-attached infinite posts keep their offset to the target and move with it, without an Ak component on the target or a ticking notify.
+	 * Only posts on a pooled emitter or aggregated instances can move, posts on a transient game object stay where they started.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Movement")
+	uint32 bFollowTarget : 1;
+
+	/** Seconds between position updates, 0 updates every frame.  Emitters far from every listener are updated less often. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Movement", Meta = (EditCondition = "bFollowTarget", ClampMin = "0.0", Units = "s"))
+	float FollowUpdateInterval;
+
+	/** RTPCs set on each post from the gameplay cue parameters, scoped to its playing ID. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Parameters")
+	TArray<FAkGameplayCueNotify_RtpcBinding> RtpcBindings;
+
+	/**
+	 * Switches set on the game object of each post, if they match the gameplay cue parameters.  The first match of each switch group wins.
+	 * Switches stay set on the game object, so other events played on the target or the same pooled emitter see them too.
+	 * Posts without an emitter of their own (pool disabled or full) only get the RTPCs.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "GameplayCueNotify|Parameters")
+	TArray<FAkGameplayCueNotify_SwitchBinding> SwitchBindings;
+};
+
+/**
+ * EAkGameplayCueBurstSlots
+ *
+ *	Slot groups of FAkGameplayCueNotify_BurstEffects (other than the Ak events) that have something to play.
+ *	Particles is set for any particle slot, empty ones still fill their entry of the spawn result.
+ */
+enum class EAkGameplayCueBurstSlots : uint8
+{
+	None				= 0,
+	Particles			= 1 << 0,
+	CameraShake			= 1 << 1,
+	CameraLensEffect	= 1 << 2,
+	ForceFeedback		= 1 << 3,
+	DeviceProperties	= 1 << 4,
+	Decal				= 1 << 5,
+};
+ENUM_CLASS_FLAGS(EAkGameplayCueBurstSlots);
+
+/**
+ * FAkGameplayCueCompiledBurst
+ *
+ *	Flat execution table of a FAkGameplayCueNotify_BurstEffects, listing only its populated slots.
+ *	Ak event slots with identical spawn conditions or placements share one record, evaluated once per execution.
+ *	Records refer to the slots by index, so the table stays valid when it is copied along with the effects.
+ *	In the editor, copies start uncompiled and edits invalidate all tables, see CurrentEditGeneration.
+ */
+struct FAkGameplayCueCompiledBurst
+{
+	FAkGameplayCueCompiledBurst() = default;
+	FAkGameplayCueCompiledBurst(FAkGameplayCueCompiledBurst&&) = default;
+	FAkGameplayCueCompiledBurst& operator=(FAkGameplayCueCompiledBurst&&) = default;
+
+#if WITH_EDITOR
+	// Copies may initialize an edited subclass or a reinstanced blueprint from its archetype, whose slots differ.
+	FAkGameplayCueCompiledBurst(const FAkGameplayCueCompiledBurst&)
+	{
+	}
+
+	FAkGameplayCueCompiledBurst& operator=(const FAkGameplayCueCompiledBurst&)
+	{
+		return *this = FAkGameplayCueCompiledBurst();
+	}
+#else
+	FAkGameplayCueCompiledBurst(const FAkGameplayCueCompiledBurst&) = default;
+	FAkGameplayCueCompiledBurst& operator=(const FAkGameplayCueCompiledBurst&) = default;
+#endif
+
+	bool IsUpToDate() const
+	{
+#if WITH_EDITOR
+		return bCompiled && (EditGeneration == CurrentEditGeneration);
+#else
+		return bCompiled;
+#endif
+	}
+
+	struct FAkEvent
+	{
+		/** Index into BurstAkEvents. */
+		int32 SlotIndex;
+		uint16 ConditionIndex;
+		uint16 PlacementIndex;
+	};
+
+	/** Slot index of the first Ak event using each distinct spawn condition and placement. */
+	TArray<int32, TInlineAllocator<2>> ConditionSlots;
+	TArray<int32, TInlineAllocator<2>> PlacementSlots;
+
+	/** Ak event slots with an event set, in slot order. */
+	TArray<FAkEvent, TInlineAllocator<4>> AkEvents;
+
+	/** Number of Ak event slots, populated or not.  Spawn results hold one playing ID per slot. */
+	int32 NumAkEventSlots = 0;
+
+	EAkGameplayCueBurstSlots Slots = EAkGameplayCueBurstSlots::None;
+	bool bCompiled = false;
+
+#if WITH_EDITOR
+	uint32 EditGeneration = 0;
+
+	/** Bumped on every property edit and blueprint reinstancing in the editor, tables compiled before are rebuilt on their next execution. */
+	static UE_API uint32 CurrentEditGeneration;
+#endif
 };
 
 /**
@@ -125,7 +545,22 @@ struct FAkGameplayCueNotify_BurstEffects
 	UE_API virtual void ExecuteEffects(const FGameplayCueNotify_SpawnContext& SpawnContext, FAkGameplayCueNotify_SpawnResult& OutSpawnResult) const;
 	UE_API virtual void ValidateAssociatedAssets(const UObject* ContainingAsset, const FString& Context, class FDataValidationContext& ValidationContext) const;
 
+	/** Spawns the effects without collecting what was spawned, for callers that never look at the spawn result. */
+	UE_API void ExecuteEffectsFireAndForget(const FGameplayCueNotify_SpawnContext& SpawnContext) const;
+
+	/** Starts loading and preparing all Ak events in the background. */
+	UE_API void PrefetchAkEvents() const;
+
 protected:
+	/** Shared by ExecuteEffects and ExecuteEffectsFireAndForget.  OutSpawnResult is null for fire and forget executions. */
+	UE_API void ExecuteCompiledEffects(const FGameplayCueNotify_SpawnContext& SpawnContext, FAkGameplayCueNotify_SpawnResult* OutSpawnResult) const;
+
+	/** Flattens the populated slots into CompiledBurst. */
+	UE_API void CompileBurst() const;
+
+	/** Execution table of the slots below.  Compiled once when the owning notify loads, or on first execution (again after edits in the editor). */
+	mutable FAkGameplayCueCompiledBurst CompiledBurst;
+
 	/** Particle systems to be spawned on gameplay cue execution.  These should never use looping effects! */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
 	TArray<FGameplayCueNotify_ParticleInfo> BurstParticles;
@@ -171,8 +606,14 @@ struct FAkGameplayCueNotify_LoopingEffects
 	UE_API void StartEffects(const FGameplayCueNotify_SpawnContext& SpawnContext, FAkGameplayCueNotify_SpawnResult& OutSpawnResult) const;
 	UE_API void StopEffects(FAkGameplayCueNotify_SpawnResult& SpawnResult) const;
 
+	/** Posts the looping Ak events that were culled when the effects started and are in range now.  Returns true while any of them remain culled. */
+	UE_API bool StartCulledEffects(const FGameplayCueNotify_SpawnContext& SpawnContext, FAkGameplayCueNotify_SpawnResult& SpawnResult) const;
+
 	UE_API virtual void ValidateAssociatedAssets(const UObject* ContainingAsset, const FString& Context, class FDataValidationContext& ValidationContext) const;
 
+	/** Starts loading and preparing all Ak events in the background. */
+	UE_API void PrefetchAkEvents() const;
+
 protected:
 	/** Particle systems to be spawned on gameplay cue loop start. */
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = GameplayCueNotify)
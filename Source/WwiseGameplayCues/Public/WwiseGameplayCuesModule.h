@@ -11,4 +11,10 @@ public:
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
 	//~End IModuleInterface
+
+private:
+#if WITH_EDITOR
+	FDelegateHandle ObjectPropertyChangedHandle;
+	FDelegateHandle ObjectsReplacedHandle;
+#endif
 };
@@ -11,8 +11,13 @@ public class WwiseGameplayCues : ModuleRules
 		PrivateDependencyModuleNames.AddRange( new []
 		{
 			"CoreUObject",
+			"DeveloperSettings",
 			"Engine",
 			"GameplayTags",
+			"Json",
+			"Projects",
+			"TraceLog",
+			"WwiseSoundEngine",
 		});
 
 		PublicDependencyModuleNames.AddRange(new []
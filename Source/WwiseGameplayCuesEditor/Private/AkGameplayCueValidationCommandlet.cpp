@@ -0,0 +1,366 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+
+#include "AkGameplayCueValidationCommandlet.h"
+
+#include "AkAudioEvent.h"
+#include "AkGameplayCueNotify_Burst.h"
+#include "AkGameplayCueNotify_BurstLatent.h"
+#include "AkGameplayCueNotify_BurstSequence.h"
+#include "AkGameplayCueNotify_Looping.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/ParallelFor.h"
+#include "Blueprint/BlueprintSupport.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Blueprint.h"
+#include "Misc/DataValidation.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AkGameplayCueValidationCommandlet)
+
+DEFINE_LOG_CATEGORY_STATIC(LogAkGameplayCueValidation, Log, All);
+
+namespace AkGameplayCueValidation
+{
+	struct FAssetEntry
+	{
+		FName PackageName;
+		FTopLevelAssetPath GeneratedClassPath;
+		FString NativeParentClass;
+
+		/** Soft referenced Ak event packages, loaded along with the asset so validation doesn't have to load them. */
+		TArray<FName> EventPackages;
+
+		TArray<FText> Errors;
+		TArray<FText> Warnings;
+
+		/** Seconds from the start of the batch until the package finished loading. */
+		double LoadSeconds = 0.0;
+		double ValidateSeconds = 0.0;
+
+		/** Only set during the batch of this asset. */
+		UObject* DefaultObject = nullptr;
+
+		EDataValidationResult Result = EDataValidationResult::NotValidated;
+		bool bLoaded = false;
+
+		TSharedRef<FJsonObject> ToJson() const
+		{
+			TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+			for (const FText& Error : Errors)
+			{
+				ErrorsJson.Add(MakeShared<FJsonValueString>(Error.ToString()));
+			}
+
+			TArray<TSharedPtr<FJsonValue>> WarningsJson;
+			for (const FText& Warning : Warnings)
+			{
+				WarningsJson.Add(MakeShared<FJsonValueString>(Warning.ToString()));
+			}
+
+			const TCHAR* ResultString = !bLoaded ? TEXT("LoadFailed")
+				: (Result == EDataValidationResult::Invalid) ? TEXT("Invalid")
+				: (Result == EDataValidationResult::Valid) ? TEXT("Valid")
+				: TEXT("NotValidated");
+
+			TSharedRef<FJsonObject> Json = MakeShared<FJsonObject>();
+			Json->SetStringField(TEXT("Package"), PackageName.ToString());
+			Json->SetStringField(TEXT("Class"), NativeParentClass);
+			Json->SetStringField(TEXT("Result"), ResultString);
+			Json->SetNumberField(TEXT("LoadMs"), LoadSeconds * 1000.0);
+			Json->SetNumberField(TEXT("ValidateMs"), ValidateSeconds * 1000.0);
+			Json->SetArrayField(TEXT("Errors"), ErrorsJson);
+			Json->SetArrayField(TEXT("Warnings"), WarningsJson);
+			return Json;
+		}
+	};
+
+	/** Finds the blueprints derived from our notify classes, along with the Ak events they reference. */
+	static void GatherAssets(IAssetRegistry& AssetRegistry, const TArray<FString>& Paths, TArray<FAssetEntry>& OutEntries)
+	{
+		const TArray<FTopLevelAssetPath> NotifyClassPaths =
+		{
+			UAkGameplayCueNotify_Burst::StaticClass()->GetClassPathName(),
+			AAkGameplayCueNotify_BurstLatent::StaticClass()->GetClassPathName(),
+			UAkGameplayCueNotify_BurstSequence::StaticClass()->GetClassPathName(),
+			AAkGameplayCueNotify_Looping::StaticClass()->GetClassPathName(),
+		};
+
+		TSet<FTopLevelAssetPath> DerivedClassPaths;
+		AssetRegistry.GetDerivedClassNames(NotifyClassPaths, {}, DerivedClassPaths);
+
+		FARFilter Filter;
+		Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		Filter.bRecursiveClasses = true;
+		Filter.bRecursivePaths = true;
+		for (const FString& Path : Paths)
+		{
+			Filter.PackagePaths.Add(*Path);
+		}
+
+		TArray<FAssetData> Blueprints;
+		AssetRegistry.GetAssets(Filter, Blueprints);
+
+		const FTopLevelAssetPath EventClassPath = UAkAudioEvent::StaticClass()->GetClassPathName();
+
+		for (const FAssetData& Blueprint : Blueprints)
+		{
+			FString GeneratedClassPath;
+			if (!Blueprint.GetTagValue(FBlueprintTags::GeneratedClassPath, GeneratedClassPath))
+			{
+				continue;
+			}
+
+			const FTopLevelAssetPath ClassPath(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath));
+			if (!DerivedClassPaths.Contains(ClassPath))
+			{
+				continue;
+			}
+
+			FAssetEntry& Entry = OutEntries.AddDefaulted_GetRef();
+			Entry.PackageName = Blueprint.PackageName;
+			Entry.GeneratedClassPath = ClassPath;
+			Entry.NativeParentClass = FPackageName::ExportTextPathToObjectPath(Blueprint.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath));
+
+			TArray<FName> Dependencies;
+			AssetRegistry.GetDependencies(Blueprint.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Soft);
+
+			for (const FName Dependency : Dependencies)
+			{
+				TArray<FAssetData> DependencyAssets;
+				AssetRegistry.GetAssetsByPackageName(Dependency, DependencyAssets);
+
+				if (DependencyAssets.ContainsByPredicate([&EventClassPath](const FAssetData& Asset) { return Asset.AssetClassPath == EventClassPath; }))
+				{
+					Entry.EventPackages.Add(Dependency);
+				}
+			}
+		}
+
+		OutEntries.Sort([](const FAssetEntry& A, const FAssetEntry& B) { return A.PackageName.LexicalLess(B.PackageName); });
+	}
+
+	/** Loads the packages of a batch (and their Ak events) concurrently, then resolves the notify CDOs. */
+	static void LoadBatch(TArrayView<FAssetEntry> Batch)
+	{
+		const double BatchStartTime = FPlatformTime::Seconds();
+
+		TSet<FName> RequestedEventPackages;
+		for (FAssetEntry& Entry : Batch)
+		{
+			LoadPackageAsync(Entry.PackageName.ToString(), FLoadPackageAsyncDelegate::CreateLambda(
+				[&Entry, BatchStartTime](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+				{
+					Entry.LoadSeconds = FPlatformTime::Seconds() - BatchStartTime;
+					Entry.bLoaded = (Result == EAsyncLoadingResult::Succeeded) && Package;
+				}));
+
+			for (const FName EventPackage : Entry.EventPackages)
+			{
+				bool bAlreadyRequested = false;
+				RequestedEventPackages.Add(EventPackage, &bAlreadyRequested);
+
+				if (!bAlreadyRequested && !FindPackage(nullptr, *EventPackage.ToString()))
+				{
+					LoadPackageAsync(EventPackage.ToString());
+				}
+			}
+		}
+
+		FlushAsyncLoading();
+
+		for (FAssetEntry& Entry : Batch)
+		{
+			const UClass* GeneratedClass = Entry.bLoaded ? FindObject<UClass>(Entry.GeneratedClassPath) : nullptr;
+			Entry.DefaultObject = GeneratedClass ? GeneratedClass->GetDefaultObject() : nullptr;
+			Entry.bLoaded = (Entry.DefaultObject != nullptr);
+		}
+	}
+
+	static void ValidateEntry(FAssetEntry& Entry)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+
+		FDataValidationContext Context;
+		Entry.Result = Entry.DefaultObject->IsDataValid(Context);
+		Context.SplitIssues(Entry.Warnings, Entry.Errors);
+
+		// Errors added without the result being flagged still fail the asset, the same way the editor validator treats them.
+		if (Entry.Errors.Num() > 0)
+		{
+			Entry.Result = EDataValidationResult::Invalid;
+		}
+
+		Entry.ValidateSeconds = FPlatformTime::Seconds() - StartTime;
+	}
+
+	/** Returns true if all Ak events of the entry are in memory, so validating it can't load anything. */
+	static bool AreEventsLoaded(const FAssetEntry& Entry)
+	{
+		for (const FName EventPackage : Entry.EventPackages)
+		{
+			if (!FindPackage(nullptr, *EventPackage.ToString()))
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+}
+
+UAkGameplayCueValidationCommandlet::UAkGameplayCueValidationCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UAkGameplayCueValidationCommandlet::Main(const FString& Params)
+{
+	using namespace AkGameplayCueValidation;
+
+	FString PathsString;
+	TArray<FString> Paths;
+	if (FParse::Value(*Params, TEXT("Paths="), PathsString))
+	{
+		PathsString.ParseIntoArray(Paths, TEXT("+"));
+	}
+
+	int32 BatchSize = 64;
+	FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+	BatchSize = FMath::Max(BatchSize, 1);
+
+	FString ReportPath;
+	if (!FParse::Value(*Params, TEXT("Report="), ReportPath))
+	{
+		ReportPath = FPaths::ProjectSavedDir() / TEXT("AkGameplayCues") / FString::Printf(TEXT("Validation-%s.json"), *FDateTime::Now().ToString());
+	}
+
+	const bool bSerial = FParse::Param(*Params, TEXT("Serial"));
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	AssetRegistry.SearchAllAssets(true);
+
+	TArray<FAssetEntry> Entries;
+	GatherAssets(AssetRegistry, Paths, Entries);
+
+	UE_LOG(LogAkGameplayCueValidation, Display, TEXT("Validating %d Ak gameplay cue notifies in batches of %d."), Entries.Num(), BatchSize);
+
+	for (int32 BatchStart = 0; BatchStart < Entries.Num(); BatchStart += BatchSize)
+	{
+		const TArrayView<FAssetEntry> Batch = MakeArrayView(Entries).Slice(BatchStart, FMath::Min(BatchSize, Entries.Num() - BatchStart));
+
+		LoadBatch(Batch);
+
+		// Entries with Ak events that failed to load validate on the game thread, where loading them again is allowed.
+		TArray<FAssetEntry*> ParallelEntries;
+		TArray<FAssetEntry*> GameThreadEntries;
+		for (FAssetEntry& Entry : Batch)
+		{
+			if (Entry.bLoaded)
+			{
+				(AreEventsLoaded(Entry) ? ParallelEntries : GameThreadEntries).Add(&Entry);
+			}
+		}
+
+		// Validation only reads the notifies.  Nothing is loaded or collected while the game thread waits here.
+		ParallelFor(TEXT("AkGameplayCueValidation"), ParallelEntries.Num(), 1,
+			[&ParallelEntries](int32 Index)
+			{
+				ValidateEntry(*ParallelEntries[Index]);
+			},
+			bSerial ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+		for (FAssetEntry* Entry : GameThreadEntries)
+		{
+			ValidateEntry(*Entry);
+		}
+
+		for (FAssetEntry& Entry : Batch)
+		{
+			Entry.DefaultObject = nullptr;
+		}
+
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+		UE_LOG(LogAkGameplayCueValidation, Display, TEXT("Validated %d/%d."), BatchStart + Batch.Num(), Entries.Num());
+	}
+
+	int32 NumInvalid = 0;
+	int32 NumLoadFailed = 0;
+	int32 NumErrors = 0;
+	int32 NumWarnings = 0;
+
+	TArray<TSharedPtr<FJsonValue>> AssetsJson;
+	AssetsJson.Reserve(Entries.Num());
+
+	for (const FAssetEntry& Entry : Entries)
+	{
+		if (!Entry.bLoaded)
+		{
+			++NumLoadFailed;
+			UE_LOG(LogAkGameplayCueValidation, Error, TEXT("%s: Failed to load."), *Entry.PackageName.ToString());
+		}
+		else if (Entry.Result == EDataValidationResult::Invalid)
+		{
+			++NumInvalid;
+		}
+
+		for (const FText& Error : Entry.Errors)
+		{
+			UE_LOG(LogAkGameplayCueValidation, Error, TEXT("%s: %s"), *Entry.PackageName.ToString(), *Error.ToString());
+		}
+
+		for (const FText& Warning : Entry.Warnings)
+		{
+			UE_LOG(LogAkGameplayCueValidation, Warning, TEXT("%s: %s"), *Entry.PackageName.ToString(), *Warning.ToString());
+		}
+
+		NumErrors += Entry.Errors.Num();
+		NumWarnings += Entry.Warnings.Num();
+
+		AssetsJson.Add(MakeShared<FJsonValueObject>(Entry.ToJson()));
+	}
+
+	const double TotalSeconds = FPlatformTime::Seconds() - StartTime;
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("Assets"), Entries.Num());
+	Report->SetNumberField(TEXT("Invalid"), NumInvalid);
+	Report->SetNumberField(TEXT("LoadFailed"), NumLoadFailed);
+	Report->SetNumberField(TEXT("Errors"), NumErrors);
+	Report->SetNumberField(TEXT("Warnings"), NumWarnings);
+	Report->SetNumberField(TEXT("BatchSize"), BatchSize);
+	Report->SetBoolField(TEXT("Serial"), bSerial);
+	Report->SetNumberField(TEXT("TotalMs"), TotalSeconds * 1000.0);
+	Report->SetArrayField(TEXT("Results"), AssetsJson);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	if (FFileHelper::SaveStringToFile(ReportString, *ReportPath))
+	{
+		UE_LOG(LogAkGameplayCueValidation, Display, TEXT("Report written to %s"), *ReportPath);
+	}
+	else
+	{
+		UE_LOG(LogAkGameplayCueValidation, Error, TEXT("Failed to write report to %s"), *ReportPath);
+	}
+
+	UE_LOG(LogAkGameplayCueValidation, Display, TEXT("%d assets, %d invalid, %d failed to load, %d errors, %d warnings in %.1f s."),
+		Entries.Num(), NumInvalid, NumLoadFailed, NumErrors, NumWarnings, TotalSeconds);
+
+	return ((NumInvalid + NumLoadFailed) > 0) ? 1 : 0;
+}
@@ -0,0 +1,17 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#include "WwiseGameplayCuesEditorModule.h"
+
+#define LOCTEXT_NAMESPACE "WwiseGameplayCuesEditor"
+
+void FWwiseGameplayCuesEditorModule::StartupModule()
+{
+}
+
+void FWwiseGameplayCuesEditorModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FWwiseGameplayCuesEditorModule, WwiseGameplayCuesEditor)
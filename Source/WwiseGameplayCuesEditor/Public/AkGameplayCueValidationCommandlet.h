@@ -0,0 +1,35 @@
+﻿// Author: Tom Werner (MajorT), 2026 February
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "AkGameplayCueValidationCommandlet.generated.h"
+
+/**
+ * UAkGameplayCueValidationCommandlet
+ *
+ *	Loads and validates all blueprints derived from the Ak gameplay cue notify classes, in batches.
+ *	The packages of a batch (and the Ak events they reference) load concurrently, then their notifies validate in parallel.
+ *	Writes a JSON report with the issues and timings of every asset, and returns non-zero if any asset is invalid.
+ *
+ *		UnrealEditor-Cmd MyProject -run=AkGameplayCueValidation [-Paths=/Game/A+/Game/B] [-BatchSize=64] [-Report=<file>] [-Serial]
+ *
+ *	-Paths			Content paths to search (recursively), separated by '+'.  Defaults to all paths.
+ *	-BatchSize		Number of assets loaded and validated at once.  Garbage is collected between batches.
+ *	-Report			Where to write the JSON report.  Defaults to Saved/AkGameplayCues/.
+ *	-Serial			Validate on the game thread only.
+ */
+UCLASS()
+class UAkGameplayCueValidationCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UAkGameplayCueValidationCommandlet();
+
+	//~Begin UCommandlet
+	virtual int32 Main(const FString& Params) override;
+	//~End UCommandlet
+};
@@ -0,0 +1,26 @@
+﻿// Copyright Epic Games, Inc. All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class WwiseGameplayCuesEditor : ModuleRules
+{
+	public WwiseGameplayCuesEditor(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PrivateDependencyModuleNames.AddRange( new []
+		{
+			"AssetRegistry",
+			"CoreUObject",
+			"Engine",
+			"GameplayAbilities",
+			"Json",
+			"WwiseGameplayCues",
+		});
+
+		PublicDependencyModuleNames.AddRange(new []
+		{
+			"Core",
+		});
+	}
+}
\ No newline at end of file